@@ -533,6 +533,8 @@ class AsyncInferQueue(AsyncInferQueueBase):
         function throws error.
 
         :param inputs: Data to be set on input tensors of the next available InferRequest.
+                       If None, the tensors already set on the request are used as is,
+                       e.g. tensors created over numpy arrays which are refilled in place.
         :type inputs: Any, optional
         :param userdata: Any data that will be passed to a callback.
         :type userdata: Any, optional
@@ -565,6 +567,10 @@ class AsyncInferQueue(AsyncInferQueueBase):
                               Default value: False
         :type share_inputs: bool, optional
         """
+        if inputs is None:
+            # Fast path: reuse the tensors which are already set on the requests
+            super().start_async(None, userdata)
+            return
         super().start_async(
             _data_dispatch(
                 self[self.get_idle_request_id()],
@@ -68,7 +68,7 @@ class AsyncInferQueue:
                     :return: If there is at least one free InferRequest in a pool, returns True.
                     :rtype: bool
         """
-    def set_callback(self, arg0: collections.abc.Callable) -> None:
+    def set_callback(self, callback: collections.abc.Callable, batched: bool = False) -> None:
         """
                     Sets unified callback on all InferRequests from queue's pool.
                     Signature of such function should have two arguments, where
@@ -85,6 +85,10 @@ class AsyncInferQueue:
         
                     :param callback: Any Python defined function that matches callback's requirements.
                     :type callback: function
+                    :param batched: If True, completed requests are queued under a mutex without taking the GIL,
+                    and their callbacks are executed in batches under a single GIL acquisition. A request
+                    becomes idle only after its callback has been executed. Default: False
+                    :type batched: bool
         """
     @typing.overload
     def start_async(self, inputs: Tensor, userdata: typing.Any) -> None:
@@ -117,6 +121,23 @@ class AsyncInferQueue:
                     :param userdata: Any data that will be passed to a callback
                     :rtype: None
         
+                    GIL is released while waiting for the next available InferRequest.
+        """
+    @typing.overload
+    def start_async(self, inputs: None, userdata: typing.Any) -> None:
+        """
+                    Run asynchronous inference using the next available InferRequest
+                    with the input tensors which are already set on it.
+        
+                    This function releases the GIL, so another Python thread can
+                    work while this function runs in the background.
+        
+                    :param inputs: None.
+                    :type inputs: None
+                    :param userdata: Any data that will be passed to a callback
+                    :type userdata: Any
+                    :rtype: None
+        
                     GIL is released while waiting for the next available InferRequest.
         """
     def wait_all(self) -> None:
@@ -26,6 +26,7 @@ public:
             jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
         }
 
+        m_completed.reserve(jobs);
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
 
@@ -58,17 +59,27 @@ public:
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
-        });
-        size_t idle_handle = m_idle_handles.front();
-        // wait for request to make sure it returned from callback
-        m_requests[idle_handle].m_request.wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return idle_handle;
+        while (true) {
+            size_t idle_handle = 0;
+            {
+                // acquire the mutex to access m_idle_handles
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] {
+                    return !(m_idle_handles.empty());
+                });
+                idle_handle = m_idle_handles.front();
+            }
+            // wait for request to make sure it returned from callback, the mutex is not held since the callback of
+            // this request may still be returning other handles to the queue
+            m_requests[idle_handle].m_request.wait();
+            // acquire the mutex to access m_errors and m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_errors.size() > 0)
+                throw m_errors.front();
+            // the handle may have been taken by another thread meanwhile
+            if (!m_idle_handles.empty() && m_idle_handles.front() == idle_handle)
+                return idle_handle;
+        }
     }
 
     void wait_all() {
@@ -79,7 +90,13 @@ public:
             request.m_request.wait();
         }
         // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_batched) {
+            // callbacks of finished requests may still be executed by another request's thread
+            m_cv.wait(lock, [this] {
+                return m_idle_handles.size() == m_requests.size();
+            });
+        }
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
@@ -110,10 +127,16 @@ public:
         }
     }
 
-    void set_custom_callbacks(py::function f_callback) {
+    void set_custom_callbacks(py::function f_callback, bool batched) {
         // need to acquire GIL before py::function deletion
         auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
 
+        m_batched = batched;
+        if (batched) {
+            set_batched_callbacks(std::move(callback_sp));
+            return;
+        }
+
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -154,6 +177,77 @@ public:
         }
     }
 
+    // Completed requests are handed over to a single drainer: the callback thread which finds no active drainer
+    // acquires the GIL and executes the Python callbacks of all completed requests, the other callback threads only
+    // append their handles to m_completed and return. Both are done under m_mutex, so no completion is lost.
+    // A handle becomes idle only after its Python callback has been executed.
+    void set_batched_callbacks(std::shared_ptr<py::function> callback_sp) {
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_completed.push_back(handle);
+                        if (m_draining) {
+                            return;  // the active drainer picks up this request
+                        }
+                        m_draining = true;
+                    }
+                    drain_completed(*callback_sp);
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_idle_handles.push(handle);
+                }
+                m_cv.notify_all();
+
+                try {
+                    std::rethrow_exception(exception_ptr);
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
+    void drain_completed(py::function& callback) {
+        std::vector<size_t> batch;
+        batch.reserve(m_requests.size());
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto handle : batch) {
+                    m_idle_handles.push(handle);
+                }
+                batch.clear();
+                batch.swap(m_completed);
+                if (batch.empty()) {
+                    // the handover is done under the mutex, a request completed later starts a new drainer
+                    m_draining = false;
+                }
+            }
+            m_cv.notify_all();
+            if (batch.empty()) {
+                return;
+            }
+
+            // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
+            py::gil_scoped_acquire acquire;
+            for (auto handle : batch) {
+                try {
+                    callback(m_requests[handle], m_user_ids[handle]);
+                } catch (const py::error_already_set& py_error) {
+                    assert(py_error.type());
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_errors.push(py_error);
+                }
+            }
+        }
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -162,6 +256,9 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    bool m_batched = false;
+    std::vector<size_t> m_completed;  // requests which wait for the batched callback, guarded by m_mutex
+    bool m_draining = false;          // a thread executes the batched callbacks, guarded by m_mutex
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -269,6 +366,41 @@ void regclass_AsyncInferQueue(py::module m) {
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    // Overload for inputs already bound to the requests, e.g. tensors sharing memory with numpy arrays
+    // which are refilled by the user. Nothing is wrapped or set on the request.
+    cls.def(
+        "start_async",
+        [](AsyncInferQueue& self, const py::none& inputs, py::object userdata) {
+            auto handle = self.get_idle_request_id();
+            {
+                std::lock_guard<std::mutex> lock(self.m_mutex);
+                self.m_idle_handles.pop();
+            }
+            self.m_user_ids[handle] = std::move(userdata);
+            {
+                py::gil_scoped_release release;
+                *self.m_requests[handle].m_start_time = Time::now();
+                self.m_requests[handle].m_request.start_async();
+            }
+        },
+        py::arg("inputs"),
+        py::arg("userdata"),
+        R"(
+            Run asynchronous inference using the next available InferRequest
+            with the input tensors which are already set on it.
+
+            This function releases the GIL, so another Python thread can
+            work while this function runs in the background.
+
+            :param inputs: None.
+            :type inputs: None
+            :param userdata: Any data that will be passed to a callback
+            :type userdata: Any
+            :rtype: None
+
+            GIL is released while waiting for the next available InferRequest.
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
@@ -303,6 +435,8 @@ void regclass_AsyncInferQueue(py::module m) {
 
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
+            py::arg("callback"),
+            py::arg("batched") = false,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -319,6 +453,10 @@ void regclass_AsyncInferQueue(py::module m) {
 
             :param callback: Any Python defined function that matches callback's requirements.
             :type callback: function
+            :param batched: If True, completed requests are queued under a mutex without taking the GIL,
+            and their callbacks are executed in batches under a single GIL acquisition. A request
+            becomes idle only after its callback has been executed. Default: False
+            :type batched: bool
         )");
 
     cls.def(
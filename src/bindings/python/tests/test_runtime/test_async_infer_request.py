@@ -58,6 +58,66 @@ def test_infer_queue(device, share_inputs):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_batched_callbacks(device):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback, batched=True)
+    # bind the input buffers once and refill them in place
+    buffers = []
+    for request in infer_queue:
+        buffers.append(generate_image())
+        request.set_input_tensor(Tensor(buffers[-1], shared_memory=True))
+
+    for i in range(jobs):
+        handle = infer_queue.get_idle_request_id()
+        buffers[handle][:] = i
+        infer_queue.start_async(userdata=i)
+    infer_queue.wait_all()
+    assert infer_queue.is_ready()
+    for i, result in enumerate(results):
+        assert np.all(result == i)
+
+
+@pytest.mark.parametrize("batched", [True, False])
+def test_infer_queue_slow_callbacks(device, batched):
+    jobs = 200
+    num_request = 8
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    finished = [0] * jobs
+
+    def callback(request, job_id):
+        # busy loop holds the GIL while other requests complete, unlike time.sleep which releases it
+        deadline = time.perf_counter() + 0.002
+        while time.perf_counter() < deadline:
+            pass
+        finished[job_id] += 1
+
+    infer_queue.set_callback(callback, batched=batched)
+    img = generate_image()
+    for i in range(jobs):
+        handle = infer_queue.get_idle_request_id()
+        assert 0 <= handle < num_request
+        infer_queue.start_async({"data": img}, i)
+        if i % 50 == 49:
+            infer_queue.wait_all()
+            assert all(count == 1 for count in finished[:i + 1])
+    infer_queue.wait_all()
+    assert infer_queue.is_ready()
+    assert all(count == 1 for count in finished)
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
@@ -18,8 +18,14 @@ class TRANSFORMATIONS_API LoraSubgraphFusion;
 }  // namespace pass
 }  // namespace ov
 
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief Fuses a LoRA adapter subgraph applied to MatMul or Convolution into LoraSubgraph operation.
+ * If support_adapter_pool is true, the A, alpha and B states may be pools of adapters stacked along axis 0,
+ * each gathered by the same per-row adapter indices, so one batch can mix rows using different adapters.
+ */
 class ov::pass::LoraSubgraphFusion : public ov::pass::MatcherPass {
 public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
-    LoraSubgraphFusion();
+    explicit LoraSubgraphFusion(bool support_adapter_pool = false);
 };
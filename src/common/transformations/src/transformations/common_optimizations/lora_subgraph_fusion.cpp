@@ -11,6 +11,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/convolution.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
@@ -23,28 +24,43 @@
 
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 
 namespace ov::pass {
 
-LoraSubgraphFusion::LoraSubgraphFusion() {
+LoraSubgraphFusion::LoraSubgraphFusion(bool support_adapter_pool) {
     MATCHER_SCOPE(LoraSubgraphFusion);
     auto lora_input_m = pattern::any_input();
     auto transpose_const1_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
     auto transpose1_m =
         pattern::optional<v1::Transpose>({lora_input_m, transpose_const1_m}, pattern::consumers_count(1));
 
+    // With an adapter pool, each state holds the tensors of all adapters stacked along axis 0,
+    // and the tensors of the adapter used by each batch row are gathered by the same indices
+    auto adapter_ids_m = pattern::any_input();
+    auto adapter_state = [&](const std::shared_ptr<ov::Node>& state_m) -> std::shared_ptr<ov::Node> {
+        if (!support_adapter_pool) {
+            return state_m;
+        }
+        auto axis_m = pattern::wrap_type<v0::Constant>(pattern::value_matches("0"));
+        return pattern::optional<v8::Gather>({state_m, adapter_ids_m, axis_m}, pattern::consumers_count(1));
+    };
+
     auto read_value1_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert1_m = pattern::optional<v0::Convert>(read_value1_m, pattern::consumers_count(1));
-    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, convert1_m}, pattern::consumers_count(1));
+    auto gather1_m = adapter_state(convert1_m);
+    auto matmul1_m = pattern::wrap_type<v0::MatMul>({transpose1_m, gather1_m}, pattern::consumers_count(1));
 
     auto read_value2_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert2_m = pattern::optional<v0::Convert>(read_value2_m, pattern::consumers_count(1));
-    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, convert2_m}, pattern::consumers_count(1));
+    auto gather2_m = adapter_state(convert2_m);
+    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, gather2_m}, pattern::consumers_count(1));
 
     auto read_value3_m = pattern::wrap_type<op_util::ReadValueBase>();
     auto convert3_m = pattern::optional<v0::Convert>(read_value3_m, pattern::consumers_count(1));
-    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, convert3_m}, pattern::consumers_count(1));
+    auto gather3_m = adapter_state(convert3_m);
+    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, gather3_m}, pattern::consumers_count(1));
 
     auto transpose_const2_m = pattern::wrap_type<v0::Constant>(pattern::consumers_count(1));
     auto transpose2_m = pattern::optional<v1::Transpose>({matmul2_m, transpose_const2_m}, pattern::consumers_count(1));
@@ -55,14 +71,31 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
         const auto& pattern_map = m.get_pattern_value_map();
         const auto& lora_input = pattern_map.at(lora_input_m);
         const auto& matmul1 = pattern_map.at(matmul1_m);
-        const auto& state_1 =
-            pattern_map.count(convert1_m) ? pattern_map.at(convert1_m) : pattern_map.at(read_value1_m);
+        const auto& state_1 = pattern_map.count(gather1_m)    ? pattern_map.at(gather1_m)
+                              : pattern_map.count(convert1_m) ? pattern_map.at(convert1_m)
+                                                              : pattern_map.at(read_value1_m);
         const auto& multiply = pattern_map.at(multiply_m);
-        const auto& state_2 =
-            pattern_map.count(convert2_m) ? pattern_map.at(convert2_m) : pattern_map.at(read_value2_m);
+        const auto& state_2 = pattern_map.count(gather2_m)    ? pattern_map.at(gather2_m)
+                              : pattern_map.count(convert2_m) ? pattern_map.at(convert2_m)
+                                                              : pattern_map.at(read_value2_m);
         const auto& matmul2 = pattern_map.at(matmul2_m);
-        const auto& state_3 =
-            pattern_map.count(convert3_m) ? pattern_map.at(convert3_m) : pattern_map.at(read_value3_m);
+        const auto& state_3 = pattern_map.count(gather3_m)    ? pattern_map.at(gather3_m)
+                              : pattern_map.count(convert3_m) ? pattern_map.at(convert3_m)
+                                                              : pattern_map.at(read_value3_m);
+
+        // the adapter pool is selected per batch row, so either all states or none of them are gathered
+        const size_t gathered_states =
+            pattern_map.count(gather1_m) + pattern_map.count(gather2_m) + pattern_map.count(gather3_m);
+        if (gathered_states != 0 && gathered_states != 3) {
+            return false;
+        }
+        for (const auto& state : {state_1, state_2, state_3}) {
+            const auto gather = ov::as_type<v8::Gather>(state.get_node());
+            if (gather && gather->get_batch_dims() != 0) {
+                return false;
+            }
+        }
+
         const auto& main_flow = pattern_map.at(main_flow_m);
         const auto& add = pattern_map.at(add_m);
 
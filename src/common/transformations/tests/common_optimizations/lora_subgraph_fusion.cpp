@@ -12,6 +12,7 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -24,6 +25,7 @@ using namespace ov;
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
 namespace v6 = ov::op::v6;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 static constexpr auto netType = ov::element::f32;
 
@@ -229,6 +231,106 @@ TEST_F(LoraSubgraphFusionMatMulTests, ReshaffledEltwiseInputs) {
     }
 }
 
+class LoraSubgraphFusionAdapterPoolTests : public TransformationTestsF {
+public:
+    LoraSubgraphFusionAdapterPoolTests() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+        comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+        comparator.enable(FunctionsComparator::CmpValues::NAMES);
+    }
+
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::pass::LoraSubgraphFusion>(true);
+    }
+
+    // Each pool stacks the adapters along axis 0, the adapter of each batch row is selected by adapter_ids
+    static ov::OutputVector gather_adapters(const ov::OutputVector& pools,
+                                            const ov::Output<ov::Node>& adapter_ids,
+                                            const std::vector<bool>& gathered = {true, true, true}) {
+        ov::OutputVector states;
+        for (size_t i = 0; i < pools.size(); ++i) {
+            if (!gathered[i]) {
+                states.push_back(pools[i]);
+                continue;
+            }
+            auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            states.push_back(std::make_shared<v8::Gather>(pools[i], adapter_ids, axis));
+        }
+        return states;
+    }
+
+    const ov::Dimension K = 563;
+    const ov::Dimension N = 2048;
+    ov::PartialShape shape_x = {-1, -1, K};
+    ov::PartialShape shape_w = {N, K};
+    ov::PartialShape shape_ids = {-1};
+    ov::PartialShape shape_pool_1 = {-1, -1, K};
+    ov::PartialShape shape_pool_2 = {-1, 1, -1};
+    ov::PartialShape shape_pool_3 = {-1, N, -1};
+};
+
+TEST_F(LoraSubgraphFusionAdapterPoolTests, GatheredStates) {
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_ids = std::make_shared<v0::Parameter>(ov::element::i32, shape_ids);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+        auto states = gather_adapters(pools.first, param_ids);
+        auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, states, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                        pools.second,
+                                        ParameterVector{param_lora, param_w, param_ids});
+    }
+    {
+        auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+        auto param_ids = std::make_shared<v0::Parameter>(ov::element::i32, shape_ids);
+        auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto pools = create_states({shape_pool_1, shape_pool_2, shape_pool_3});
+        auto states = gather_adapters(pools.first, param_ids);
+
+        auto inner_param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto inner_state_1 = std::make_shared<v0::Parameter>(netType, states[0].get_partial_shape());
+        auto inner_state_2 = std::make_shared<v0::Parameter>(netType, states[1].get_partial_shape());
+        auto inner_state_3 = std::make_shared<v0::Parameter>(netType, states[2].get_partial_shape());
+        auto inner_param_mm = std::make_shared<v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+
+        ov::OutputVector states_outs{inner_state_1, inner_state_2, inner_state_3};
+        auto lora_subgraph = create_lora_subgraph(inner_param_mm, inner_param_lora, states_outs, false);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm, inner_param_lora, inner_state_1, inner_state_2, inner_state_3};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        ov::OutputVector lora_inputs{main_mm, param_lora, states[0], states[1], states[2]};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm},
+                                            pools.second,
+                                            ParameterVector{param_lora, param_w, param_ids});
+    }
+}
+
+TEST_F(LoraSubgraphFusionAdapterPoolTests, PartiallyGatheredStatesAreNotFused) {
+    auto param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+    auto param_w = std::make_shared<v0::Parameter>(netType, shape_w);
+    auto param_ids = std::make_shared<v0::Parameter>(ov::element::i32, shape_ids);
+    auto main_mm = std::make_shared<v0::MatMul>(param_lora, param_w, false, true);
+    main_mm->set_friendly_name("main_mm");
+    auto pools = create_states({shape_pool_1, {1, -1}, shape_pool_3});
+    auto states = gather_adapters(pools.first, param_ids, {true, false, true});
+    auto lora_subgraph = create_lora_subgraph(main_mm, param_lora, states, false);
+    lora_subgraph->set_friendly_name("lora_subgraph");
+    model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm},
+                                    pools.second,
+                                    ParameterVector{param_lora, param_w, param_ids});
+}
+
 class LoraSubgraphFusionConvolutionTests : public LoraSubgraphFusionTests {
 public:
     const ov::Dimension num_channels = 320;
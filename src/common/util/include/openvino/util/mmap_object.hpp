@@ -33,6 +33,15 @@ class MappedMemory {
 public:
     virtual char* data() noexcept = 0;
     virtual size_t size() const noexcept = 0;
+    /**
+     * @brief Hints that the given range of the mapped memory will be accessed soon.
+     * The pages are read in the background, so the first access doesn't wait for the disk.
+     * Default implementation does nothing.
+     *
+     * @param offset Offset of the range in bytes.
+     * @param size Size of the range in bytes.
+     */
+    virtual void prefetch(size_t /*offset*/, size_t /*size*/) noexcept {}
     virtual ~MappedMemory() = default;
 };
 
@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -105,6 +106,17 @@ public:
     size_t size() const noexcept override {
         return m_size;
     }
+
+    void prefetch(size_t offset, size_t size) noexcept override {
+        if (m_data == MAP_FAILED || offset >= m_size || size == 0) {
+            return;
+        }
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t begin = offset / page_size * page_size;
+        const size_t end = std::min(offset + size, m_size);
+        // the hint is best effort, an error doesn't affect the mapping
+        madvise(static_cast<char*>(m_data) + begin, end - begin, MADV_WILLNEED);
+    }
 };
 
 std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::filesystem::path& path) {
@@ -27,7 +27,9 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
+    /// @param data_alignment If greater than 1, every new blob starts at an offset which is a multiple of it,
+    ///                       so the weights can be mapped from the file and used without a copy.
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, size_t data_alignment = 0);
     virtual ~ConstantWriter();
 
     virtual FilePosition write(const char* ptr,
@@ -38,6 +40,8 @@ public:
                                bool ptr_is_temporary = false);
 
 private:
+    FilePosition align_output();
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
@@ -48,5 +52,6 @@ private:
     bool m_enable_compression;
     bool m_write_hash_value;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    size_t m_data_alignment;
 };
 }  // namespace ov::util
@@ -317,6 +317,18 @@ void save_model(const std::shared_ptr<const ov::Model>& model,
                 bool compress_to_fp16 = true);
 #endif
 
+/// \brief Save given model into IR where every constant in the .bin file starts at an offset which is a multiple of
+/// data_alignment, so the weights can be mapped from the file and used without a copy.
+/// \param model Model which will be converted to IR representation.
+/// \param output_model Path to the output model file, must have extension .xml.
+/// \param compress_to_fp16 Whether to compress floating point weights to FP16.
+/// \param data_alignment Alignment of the constants in the .bin file in bytes (e.g. 4096 for page aligned weights).
+OPENVINO_API
+void save_model(const std::shared_ptr<const ov::Model>& model,
+                const std::filesystem::path& output_model,
+                bool compress_to_fp16,
+                size_t data_alignment);
+
 /// \}
 
 }  // namespace ov
@@ -55,6 +55,39 @@ private:
     const std::map<std::string, ov::OpSet> m_custom_opsets;
 };
 
+/**
+ * @brief AlignedSerialize transformation converts ov::Model into IR files where every constant in the .bin file
+ * starts at an offset which is a multiple of the given alignment, so the weights can be mapped from the file and used
+ * without a copy (e.g. 4096 for page aligned weights).
+ * @attention
+ * - dynamic shapes are not supported
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API AlignedSerialize : public ov::pass::ModelPass {
+public:
+    OPENVINO_MODEL_PASS_RTTI("AlignedSerialize");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    AlignedSerialize(std::ostream& xmlFile,
+                     std::ostream& binFile,
+                     size_t data_alignment,
+                     Serialize::Version version = Serialize::Version::UNSPECIFIED);
+
+    AlignedSerialize(const std::filesystem::path& xmlPath,
+                     const std::filesystem::path& binPath,
+                     size_t data_alignment,
+                     Serialize::Version version = Serialize::Version::UNSPECIFIED);
+
+private:
+    std::ostream* m_xmlFile;
+    std::ostream* m_binFile;
+    const std::filesystem::path m_xmlPath;
+    const std::filesystem::path m_binPath;
+    const Serialize::Version m_version;
+    const size_t m_data_alignment;
+};
+
 /**
  * @brief StreamSerialize transformation converts ov::Model into single binary stream
  * @attention
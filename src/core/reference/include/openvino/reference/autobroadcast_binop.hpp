@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <numeric>
 #include <utility>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
@@ -89,23 +92,14 @@ void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count
     }
 }
 
-/**
- * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
- *
- * @param arg0       Pointer to input 0 data.
- * @param arg1       Pointer to input 1 data.
- * @param out        Pointer to output data.
- * @param arg0_shape Shape of input 0.
- * @param arg1_shape Shape of input 1.
- * @param f          Binary elementwise functions.
- */
+namespace internal {
 template <typename T, typename U, class Functor>
-void numpy_broadcast_binop(const T* arg0,
-                           const T* arg1,
-                           U* out,
-                           const Shape& arg0_shape,
-                           const Shape& arg1_shape,
-                           Functor f) {
+void numpy_broadcast_binop_seq(const T* arg0,
+                               const T* arg1,
+                               U* out,
+                               const Shape& arg0_shape,
+                               const Shape& arg1_shape,
+                               Functor f) {
     // We'll be using CoordinateTransformBasic to handle the broadcasting. The general procedure is as follows:
     //
     // (1) Left pad the shorter of the two shapes with ones.
@@ -203,6 +197,90 @@ void numpy_broadcast_binop(const T* arg0,
                                                   strides0[axis],
                                                   f);
 }
+}  // namespace internal
+
+/**
+ * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
+ *
+ * Big outputs are split between threads by the outermost output dimension which is not 1.
+ * All outer dimensions are 1, so each part is an independent broadcast of contiguous parts of the inputs.
+ *
+ * @param arg0       Pointer to input 0 data.
+ * @param arg1       Pointer to input 1 data.
+ * @param out        Pointer to output data.
+ * @param arg0_shape Shape of input 0.
+ * @param arg1_shape Shape of input 1.
+ * @param f          Binary elementwise functions.
+ */
+template <typename T, typename U, class Functor>
+void numpy_broadcast_binop(const T* arg0,
+                           const T* arg1,
+                           U* out,
+                           const Shape& arg0_shape,
+                           const Shape& arg1_shape,
+                           Functor f) {
+    using namespace internal;
+    constexpr size_t min_work_per_thread = 1 << 15;
+
+    const size_t out_rank = std::max(arg0_shape.size(), arg1_shape.size());
+    const size_t padding0 = out_rank - arg0_shape.size();
+    const size_t padding1 = out_rank - arg1_shape.size();
+
+    Shape output_shape(out_rank);
+    size_t split_axis = out_rank;
+    for (size_t i = 0; i < out_rank; ++i) {
+        output_shape[i] = std::max(value_with_padding_or(arg0_shape, padding0, i, 1),
+                                   value_with_padding_or(arg1_shape, padding1, i, 1));
+        if (split_axis == out_rank && output_shape[i] != 1)
+            split_axis = i;
+    }
+
+    const size_t work_amount = shape_size(output_shape);
+    const size_t nthr = split_axis == out_rank ? 1
+                                               : std::min({static_cast<size_t>(parallel_get_max_threads()),
+                                                           work_amount / min_work_per_thread,
+                                                           output_shape[split_axis]});
+    if (nthr <= 1) {
+        numpy_broadcast_binop_seq(arg0, arg1, out, arg0_shape, arg1_shape, f);
+        return;
+    }
+
+    const auto inner_size = [split_axis](const Shape& shape, size_t padding) {
+        return std::accumulate(shape.begin() + (split_axis - padding + 1),
+                               shape.end(),
+                               size_t{1},
+                               std::multiplies<size_t>());
+    };
+    const auto is_split = [split_axis](const Shape& shape, size_t padding) {
+        return split_axis >= padding && shape[split_axis - padding] != 1;
+    };
+    const bool split0 = is_split(arg0_shape, padding0);
+    const bool split1 = is_split(arg1_shape, padding1);
+    const size_t inner0 = split0 ? inner_size(arg0_shape, padding0) : 0;
+    const size_t inner1 = split1 ? inner_size(arg1_shape, padding1) : 0;
+    const size_t inner_out = inner_size(output_shape, 0);
+
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int team) {
+        size_t start = 0, end = 0;
+        ov::splitter(output_shape[split_axis], static_cast<size_t>(team), static_cast<size_t>(ithr), start, end);
+        if (start >= end)
+            return;
+
+        Shape part0_shape = arg0_shape;
+        Shape part1_shape = arg1_shape;
+        if (split0)
+            part0_shape[split_axis - padding0] = end - start;
+        if (split1)
+            part1_shape[split_axis - padding1] = end - start;
+
+        numpy_broadcast_binop_seq(arg0 + start * inner0,
+                                  arg1 + start * inner1,
+                                  out + start * inner_out,
+                                  part0_shape,
+                                  part1_shape,
+                                  f);
+    });
+}
 
 /**
  * @brief Apply elementwise function for 2 inputs and apply PDPP broadcasting.
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape.hpp"
 #include "utils/span.hpp"
 
@@ -30,6 +32,31 @@ void gather(const T* const data,
     int64_t batch_out_mul = shape_size(span(out_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
+
+    // big outputs are gathered in parallel by the output rows of inner_size elements
+    constexpr size_t parallel_threshold = 1 << 15;
+    const int64_t rows = batch_size * outer_size * indices_size;
+    if (shape_size(out_shape) >= parallel_threshold && rows > 1) {
+        ov::parallel_for(rows, [&](int64_t row) {
+            const int64_t i = row % indices_size;
+            const int64_t outer_idx = (row / indices_size) % outer_size;
+            const int64_t batch = row / (indices_size * outer_size);
+            const auto out_ptr = std::next(out, batch_out_mul * batch + inner_size * (indices_size * outer_idx + i));
+            int64_t idx = indices[i + indices_size * batch];
+            if (idx < 0)
+                idx += axis_size;
+            // for out of bound values have to be filled with zeros
+            if (idx >= axis_size || idx < 0) {
+                std::fill_n(out_ptr, inner_size, T{0});
+                return;
+            }
+            const auto src_begin =
+                std::next(data, batch_data_mul * batch + inner_size * axis_size * outer_idx + inner_size * idx);
+            std::copy_n(src_begin, inner_size, out_ptr);
+        });
+        return;
+    }
+
     int64_t data_offset, out_offset, idx;
     // for out of bound indices is filled with zeros
     std::fill(out, out + shape_size(out_shape), T{0});
@@ -9,12 +9,15 @@
 #include <utility>
 #include <vector>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/broadcast.hpp"
 #include "openvino/reference/reshape.hpp"
 
 namespace ov {
 namespace reference {
 namespace details {
+constexpr size_t parallel_threshold = 1 << 15;
+
 template <typename T>
 void dot(const T* arg0,
          const T* arg1,
@@ -33,7 +36,7 @@ void dot(const T* arg0,
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-    for (size_t i = 0; i < I_dim; ++i) {
+    auto dot_row = [&](size_t i) {
         for (size_t k = 0; k < K_dim; ++k) {
             const size_t a_idx = i * K_dim + k;
             for (size_t j = 0; j < J_dim; ++j) {
@@ -42,6 +45,14 @@ void dot(const T* arg0,
                 out[out_idx] += arg0[a_idx] * arg1[b_idx];
             }
         }
+    };
+    // the rows of the output are independent, so big products are computed in parallel by rows
+    if (I_dim > 1 && I_dim * J_dim * K_dim >= parallel_threshold) {
+        ov::parallel_for(I_dim, dot_row);
+    } else {
+        for (size_t i = 0; i < I_dim; ++i) {
+            dot_row(i);
+        }
     }
 }
 
@@ -206,13 +217,23 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
+    auto batch_dot = [&](size_t i) {
         details::dot(arg0_data + i * arg0_offset,
                      arg1_data + i * arg1_offset,
                      out + i * output_offset,
                      dot_arg0_shape,
                      dot_arg1_shape,
                      dot_output_shape);
+    };
+    // the batches are independent, so many of them are computed in parallel
+    // the reduced dimension is the first one of the right operand of the dot, both for {K} and {K, J} shapes
+    const size_t K_dim = dot_arg1_shape[0];
+    if (output_batch_size > 1 && output_batch_size * output_offset * K_dim >= details::parallel_threshold) {
+        ov::parallel_for(output_batch_size, batch_dot);
+    } else {
+        for (size_t i = 0; i < output_batch_size; i++) {
+            batch_dot(i);
+        }
     }
 }
 }  // namespace reference
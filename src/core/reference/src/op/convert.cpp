@@ -4,6 +4,7 @@
 
 #include "openvino/reference/convert.hpp"
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/utils/convert_util.hpp"
 
 #ifdef OV_CORE_USE_XBYAK_JIT
@@ -479,7 +480,7 @@ public:
 #endif  // OV_CORE_USE_XBYAK_JIT
 
 template <class Clamp, typename TI, typename TO>
-void convert_impl(const TI* arg, TO* out, size_t count) {
+void convert_block(const TI* arg, TO* out, size_t count) {
 #ifdef OV_CORE_USE_XBYAK_JIT
     if (util::may_i_use_dynamic_code()) {
         if (auto converter = jit_convert_array::get<TI, TO, Clamp::enabled>()) {
@@ -491,6 +492,24 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
 #endif  // OV_CORE_USE_XBYAK_JIT
     Converter<TI, TO>::template apply<Clamp>(arg, out, count);
 }
+
+template <class Clamp, typename TI, typename TO>
+void convert_impl(const TI* arg, TO* out, size_t count) {
+    // big buffers (e.g. folded weights decompression) are converted by blocks in parallel
+    constexpr size_t min_block_size = 1 << 16;
+    const auto nthr = std::min(static_cast<size_t>(parallel_get_max_threads()), count / min_block_size);
+    if (nthr <= 1) {
+        convert_block<Clamp>(arg, out, count);
+        return;
+    }
+    ov::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int team) {
+        size_t start = 0, end = 0;
+        ov::splitter(count, static_cast<size_t>(team), static_cast<size_t>(ithr), start, end);
+        if (start < end) {
+            convert_block<Clamp>(arg + start, out + start, end - start);
+        }
+    });
+}
 }  // namespace
 
 template <>
@@ -315,6 +315,13 @@ void serialize(const std::shared_ptr<const ov::Model>& m,
 void save_model(const std::shared_ptr<const ov::Model>& m,
                 const std::filesystem::path& output_model,
                 bool compress_to_fp16) {
+    save_model(m, output_model, compress_to_fp16, 0);
+}
+
+void save_model(const std::shared_ptr<const ov::Model>& m,
+                const std::filesystem::path& output_model,
+                bool compress_to_fp16,
+                size_t data_alignment) {
     auto cloned = m->clone();
     if (compress_to_fp16) {
         // TODO: Implement on-the-fly compression in pass::Serialize, Ticket: 145380
@@ -324,7 +331,7 @@ void save_model(const std::shared_ptr<const ov::Model>& m,
 
     ov::pass::Manager manager("SaveModel");
     manager.register_pass<ov::pass::FusedNamesCleanup>();
-    manager.register_pass<ov::pass::Serialize>(output_model, "");
+    manager.register_pass<ov::pass::AlignedSerialize>(output_model, "", data_alignment);
     manager.run_passes(std::move(cloned));
 }
 
@@ -4,6 +4,13 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
 #include "openvino/core/rt_info.hpp"
@@ -14,6 +21,7 @@
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "profiling.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 
@@ -101,9 +109,75 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+namespace {
+/**
+ * \brief Collects the constant folding time per operation type.
+ *
+ * Enabled together with the transformations profiling by OV_ENABLE_PROFILE_PASS. If the variable contains a path,
+ * the records are appended to this file as `cf;{type};{count};{time_ns}` lines, otherwise they are printed to stdout.
+ */
+class FoldingProfiler {
+public:
+    FoldingProfiler() : m_profile_pass("OV_ENABLE_PROFILE_PASS") {}
+
+    bool is_enabled() const {
+        return m_profile_pass.is_enabled();
+    }
+
+    void start() {
+        m_stopwatch.start();
+    }
+
+    void stop(const ov::Node& node) {
+        m_stopwatch.stop();
+        auto& record = m_records[node.get_type_info()];
+        record.count++;
+        record.time += m_stopwatch.get_timer_value();
+    }
+
+    void dump() const {
+        if (!is_enabled() || m_records.empty()) {
+            return;
+        }
+        std::vector<std::pair<ov::DiscreteTypeInfo, Record>> records(m_records.begin(), m_records.end());
+        std::sort(records.begin(), records.end(), [](const auto& l, const auto& r) {
+            return l.second.time > r.second.time;
+        });
+
+        if (m_profile_pass.is_bool()) {
+            for (const auto& record : records) {
+                std::cout << "  ConstantFolding " << std::setw(43) << std::left << record.first.name;
+                std::cout << std::setw(8) << std::right << record.second.count << " nodes ";
+                std::cout << std::setw(8) << std::right
+                          << std::chrono::duration_cast<std::chrono::milliseconds>(record.second.time).count() << "ms"
+                          << std::endl;
+            }
+        } else {
+            std::ofstream file(m_profile_pass.get_str(), std::ios_base::app);
+            for (const auto& record : records) {
+                file << "cf;" << record.first.name << ";" << record.second.count << ";" << record.second.time.count()
+                     << std::endl;
+            }
+        }
+    }
+
+private:
+    struct Record {
+        size_t count = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    ov::pass::EnvVar m_profile_pass;
+    ov::pass::stopwatch m_stopwatch;
+    std::map<ov::DiscreteTypeInfo, Record> m_records;
+};
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
+    FoldingProfiler profiler;
+
     bool rewritten = pre_calculated_values_folding(model);
 
     // Creating a local vector and moving each element to reduce memory peak.
@@ -139,7 +213,14 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
+        if (profiler.is_enabled()) {
+            profiler.start();
+        }
+        const bool folded = node->constant_fold(replacements, node->input_values());
+        if (profiler.is_enabled()) {
+            profiler.stop(*original_node);
+        }
+        if (folded) {
             OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
@@ -175,6 +256,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         }
     }
 
+    profiler.dump();
     return rewritten;
 }
 
@@ -22,6 +22,7 @@
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
+#include "profiling.hpp"
 
 #ifdef ENABLE_PROFILING_ITT_FULL
 
@@ -40,104 +41,8 @@ PerfCounters& perf_counters() {
 
 namespace {
 
-/**
- * @brief EnvVar gets the environment variable value by name.
- * It tries to interpret the value as boolean, if it fails then
- * the original string value is stored. This behavior helps us to reduce the number
- * of the additional env variables.
- *
- * Example of usage:
- * if OV_ENABLE_PROFILE_PASS is true, it enables console output.
- * if OV_ENABLE_PROFILE_PASS contains a path to file (string), the out logs
- * will be re-directed to the file.
- */
-class EnvVar {
-public:
-    explicit EnvVar(const std::string& var) {
-        const auto& val = ov::util::getenv_string(var.c_str());
-        std::set<std::string> off = {"0", "false", "off"};
-        std::set<std::string> on = {"1", "true", "on"};
-
-        const auto& val_lower = ov::util::to_lower(val);
-        if (off.count(val_lower)) {
-            m_is_bool = true;
-        } else if (on.count(val_lower)) {
-            m_is_bool = true;
-            b_value = true;
-        } else {
-            s_value = val;
-        }
-    }
-
-    /**
-     * @brief This ctor helps to activate/deactivate EnvVar from the code.
-     */
-    explicit EnvVar(const std::string& var, bool activate) {
-        m_is_bool = true;
-        b_value = activate;
-    }
-
-    bool is_enabled() const {
-        return b_value || !s_value.empty();
-    }
-
-    bool is_bool() const {
-        return m_is_bool;
-    }
-
-    const std::string& get_str() const {
-        return s_value;
-    }
-
-private:
-    bool m_is_bool = false;
-    bool b_value = false;
-    std::string s_value;
-};
-
-class stopwatch {
-public:
-    void start() {
-        if (!m_active) {
-            m_active = true;
-            m_start_time = m_clock.now();
-        }
-    }
-
-    void stop() {
-        if (m_active) {
-            m_end_time = m_clock.now();
-            m_last_time = m_end_time - m_start_time;
-            m_active = false;
-        }
-    }
-
-    std::chrono::nanoseconds get_timer_value() const {
-        if (m_active) {
-            return (m_clock.now() - m_start_time);
-        } else {
-            return m_last_time;
-        }
-    }
-
-    size_t get_milliseconds() const {
-        return std::chrono::duration_cast<std::chrono::milliseconds>(get_timer_value()).count();
-    }
-
-    std::chrono::nanoseconds get_start_time() const {
-        return std::chrono::duration_cast<std::chrono::nanoseconds>(m_start_time.time_since_epoch());
-    }
-
-    std::chrono::nanoseconds get_end_time() const {
-        return std::chrono::duration_cast<std::chrono::nanoseconds>(m_end_time.time_since_epoch());
-    }
-
-private:
-    std::chrono::high_resolution_clock m_clock;
-    std::chrono::time_point<std::chrono::high_resolution_clock> m_start_time, m_end_time;
-    bool m_active = false;
-    std::chrono::nanoseconds m_last_time = std::chrono::high_resolution_clock::duration::zero();
-};
+using ov::pass::EnvVar;
+using ov::pass::stopwatch;
 
 class Profiler {
 public:
@@ -9,6 +9,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/coordinate_diff.hpp"
@@ -31,6 +32,8 @@
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 namespace {
+constexpr size_t bin_file_buffer_size = 4 * 1024 * 1024;
+
 const std::filesystem::path valid_xml_path(const std::filesystem::path& path) {
     OPENVINO_ASSERT(path.extension() == ".xml",
                     "Path for xml file doesn't contains file name with 'xml' extension: \"",
@@ -88,50 +91,65 @@ void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
-                    bool deterministic = false) {
-    ov::util::ConstantWriter constant_write_handler(bin_file);
+                    bool deterministic = false,
+                    size_t data_alignment = 0) {
+    ov::util::ConstantWriter constant_write_handler(bin_file, true, data_alignment);
     serialize_func(xml_file, bin_file, std::move(model), ver, deterministic, constant_write_handler);
 }
-}  // namespace
-
-namespace ov {
-bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
-    RUN_ON_FUNCTION_SCOPE(Serialize);
 
+// Common body of Serialize and AlignedSerialize, the streams are used when both are set, the paths otherwise
+void serialize_model(const std::shared_ptr<ov::Model>& model,
+                     std::ostream* xml_stream,
+                     std::ostream* bin_stream,
+                     const std::filesystem::path& xml_path,
+                     const std::filesystem::path& bin_path,
+                     ov::pass::Serialize::Version version,
+                     size_t data_alignment) {
     model->validate_nodes_and_infer_types();
 
     // TODO xxx-105807: if rt_info is set in python api as a string ['precise_0'] = '',
     //  we need to convert value to a class in order to have rt_info in the IR. The code below will convert
     // ['precise_0'] = '' into => rt_info['precise_0'] = DisableFP16Compression{}
     for (auto& node : model->get_ops())
-        if (fp16_compression_is_disabled(node))
-            disable_fp16_compression(node);
+        if (ov::fp16_compression_is_disabled(node))
+            ov::disable_fp16_compression(node);
 
-    if (m_xmlFile && m_binFile) {
-        serialize_func(*m_xmlFile, *m_binFile, model, m_version);
+    if (xml_stream && bin_stream) {
+        serialize_func(*xml_stream, *bin_stream, model, version, false, data_alignment);
     } else {
-        ov::util::create_directory_recursive(m_xmlPath.parent_path());
+        ov::util::create_directory_recursive(xml_path.parent_path());
 
-        std::ofstream bin_file(m_binPath, std::ios::binary);
-        OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
+        // Small constants are coalesced into large writes, big ones bypass the buffer
+        std::vector<char> bin_buffer(bin_file_buffer_size);
+        std::ofstream bin_file;
+        bin_file.rdbuf()->pubsetbuf(bin_buffer.data(), static_cast<std::streamsize>(bin_buffer.size()));
+        bin_file.open(bin_path, std::ios::binary);
+        OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", bin_path, "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath);
-        OPENVINO_ASSERT(xml_file, "Can't open xml file: \"", m_xmlPath, "\"");
+        std::ofstream xml_file(xml_path);
+        OPENVINO_ASSERT(xml_file, "Can't open xml file: \"", xml_path, "\"");
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            serialize_func(xml_file, bin_file, model, version, false, data_alignment);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
             // hence we need to delete it here in case of failure
             xml_file.close();
             bin_file.close();
-            std::ignore = std::filesystem::remove(m_xmlPath);
-            std::ignore = std::filesystem::remove(m_binPath);
+            std::ignore = std::filesystem::remove(xml_path);
+            std::ignore = std::filesystem::remove(bin_path);
             throw;
         }
     }
+}
+}  // namespace
+
+namespace ov {
+bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_FUNCTION_SCOPE(Serialize);
+    serialize_model(model, m_xmlFile, m_binFile, m_xmlPath, m_binPath, m_version, 0);
 
     // Return false because we didn't change ov Model
     return false;
@@ -151,6 +169,36 @@ pass::Serialize::Serialize(const std::filesystem::path& xmlPath, const std::file
       m_binPath{provide_bin_path(xmlPath, binPath)},
       m_version{version} {}
 
+bool pass::AlignedSerialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(AlignedSerialize);
+    serialize_model(model, m_xmlFile, m_binFile, m_xmlPath, m_binPath, m_version, m_data_alignment);
+
+    // Return false because we didn't change ov Model
+    return false;
+}
+
+pass::AlignedSerialize::AlignedSerialize(std::ostream& xmlFile,
+                                         std::ostream& binFile,
+                                         size_t data_alignment,
+                                         Serialize::Version version)
+    : m_xmlFile{&xmlFile},
+      m_binFile{&binFile},
+      m_xmlPath{},
+      m_binPath{},
+      m_version{version},
+      m_data_alignment{data_alignment} {}
+
+pass::AlignedSerialize::AlignedSerialize(const std::filesystem::path& xmlPath,
+                                         const std::filesystem::path& binPath,
+                                         size_t data_alignment,
+                                         Serialize::Version version)
+    : m_xmlFile{nullptr},
+      m_binFile{nullptr},
+      m_xmlPath{valid_xml_path(xmlPath)},
+      m_binPath{provide_bin_path(xmlPath, binPath)},
+      m_version{version},
+      m_data_alignment{data_alignment} {}
+
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        const std::function<void(std::ostream&)>& custom_data_serializer,
                                        const std::function<std::string(const std::string&)>& cache_encrypt,
@@ -4,7 +4,10 @@
 
 #include "openvino/xml_util/constant_writer.hpp"
 
+#include <vector>
+
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/common_util.hpp"
@@ -20,11 +23,12 @@ std::streamsize OstreamHashWrapperBin::xsputn(const char* s, std::streamsize n)
     return n;
 }
 
-ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
+ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression, size_t data_alignment)
     : m_binary_output(bin_data),
       m_enable_compression(enable_compression),
       m_write_hash_value(static_cast<bool>(dynamic_cast<OstreamHashWrapperBin*>(bin_data.rdbuf()))),
-      m_blob_offset(bin_data.tellp()) {}
+      m_blob_offset(bin_data.tellp()),
+      m_data_alignment(data_alignment) {}
 
 ConstantWriter::~ConstantWriter() = default;
 
@@ -36,11 +40,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    bool ptr_is_temporary) {
     // when true, do not rely on ptr after this function call, data
     // is temporary allocated
-    const FilePosition write_pos = m_binary_output.get().tellp();
-    const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
     if (!m_enable_compression) {
+        const auto offset = align_output();
         if (!compress_to_fp16) {
             m_binary_output.get().write(ptr, size);
         } else {
@@ -75,6 +78,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                 return it->second.first;
             }
         }
+        const auto offset = align_output();
         if (!ptr_is_temporary) {
             // Since fp16_compressed data will be disposed at exit point and since we cannot reread it from the
             // ostream, we store pointer to the original uncompressed blob.
@@ -86,8 +90,22 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         } else {
             m_binary_output.get().write(ptr_to_write, new_size);
         }
+        return offset;
+    }
+}
+
+ConstantWriter::FilePosition ConstantWriter::align_output() {
+    const FilePosition offset = static_cast<FilePosition>(m_binary_output.get().tellp()) - m_blob_offset;
+    if (m_data_alignment <= 1 || m_write_hash_value) {
+        return offset;
     }
-    return offset;
+    const auto alignment = static_cast<FilePosition>(m_data_alignment);
+    const auto padding = (alignment - offset % alignment) % alignment;
+    if (padding != 0) {
+        const std::vector<char> zeros(static_cast<size_t>(padding), 0);
+        m_binary_output.get().write(zeros.data(), padding);
+    }
+    return offset + padding;
 }
 
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
@@ -108,7 +126,7 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
         auto src_data = reinterpret_cast<const double*>(ptr);
 
         // Reference implementation for fp64 to fp16 conversion
-        for (size_t i = 0; i < num_src_elements; ++i) {
+        ov::parallel_for(num_src_elements, [&](size_t i) {
             // if abs value is smaller than the smallest positive fp16, but not zero
             if (std::abs(src_data[i]) < ov::float16::from_bits(0x0001) && src_data[i] != 0.0f) {
                 dst_data[i] = 0;
@@ -119,7 +137,7 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
             } else {
                 dst_data[i] = static_cast<ov::float16>(src_data[i]);
             }
-        }
+        });
         return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
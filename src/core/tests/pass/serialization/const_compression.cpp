@@ -9,6 +9,7 @@
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
+#include "openvino/core/graph_util.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
@@ -376,3 +377,53 @@ TEST_F(SerializationConstantCompressionTest, EmptyAndNotEmptyConstantsDifferentV
     const auto& [success, message] = compare_functions(model_initial, model_imported, true, true, false, true, true);
     ASSERT_TRUE(success) << message;
 }
+
+TEST_F(SerializationConstantCompressionTest, AlignedDataLayout) {
+    constexpr size_t alignment = 64;
+    auto A = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{3}, std::vector<int8_t>{1, 2, 3});
+    auto B = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{3}, std::vector<int8_t>{4, 5, 6});
+    auto C = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{3}, std::vector<int8_t>{1, 2, 3});
+
+    auto model_initial = std::make_shared<ov::Model>(ov::OutputVector{A, B, C}, ov::ParameterVector{});
+
+    ov::pass::AlignedSerialize(m_out_xml_path_1, m_out_bin_path_1, alignment).run_on_model(model_initial);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // the duplicate of A is not written, B starts at the next aligned offset
+    ASSERT_EQ(file_size(bin_1), alignment + 3 * sizeof(int8_t));
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+
+    const auto& [success, message] = compare_functions(model_initial, model_imported, true, true, false, true, true);
+    ASSERT_TRUE(success) << message;
+    for (const auto& op : model_imported->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % alignment, 0u);
+        }
+    }
+}
+
+TEST_F(SerializationConstantCompressionTest, SaveModelAlignedDataLayout) {
+    constexpr size_t alignment = 4096;
+    auto A = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{3}, std::vector<int8_t>{1, 2, 3});
+    auto B = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{2}, std::vector<float>{4.0f, 5.0f});
+
+    auto model_initial = std::make_shared<ov::Model>(ov::OutputVector{A, B}, ov::ParameterVector{});
+
+    ov::save_model(model_initial, m_out_xml_path_1, true, alignment);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    // B is compressed to f16 and starts at the next page
+    ASSERT_EQ(file_size(bin_1), alignment + 2 * sizeof(ov::float16));
+
+    ov::Core core;
+    auto model_imported = core.read_model(m_out_xml_path_1, m_out_bin_path_1);
+    for (const auto& op : model_imported->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(constant->get_data_ptr()) % alignment, 0u);
+        }
+    }
+}
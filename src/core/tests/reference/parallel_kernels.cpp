@@ -0,0 +1,180 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "openvino/core/type/float16.hpp"
+#include "openvino/reference/autobroadcast_binop.hpp"
+#include "openvino/reference/convert.hpp"
+#include "openvino/reference/gather.hpp"
+#include "openvino/reference/matmul.hpp"
+
+// The kernels below switch to a parallel implementation for big outputs, the sizes of the tests are chosen above the
+// thresholds and are not divisible by the number of threads, so the split produces uneven tails.
+namespace parallel_kernels_test {
+using ov::Shape;
+using ov::shape_size;
+
+template <typename T>
+std::vector<T> iota_data(const Shape& shape, T start = T{0}) {
+    std::vector<T> data(shape_size(shape));
+    std::iota(data.begin(), data.end(), start);
+    return data;
+}
+
+struct BroadcastBinopParams {
+    Shape arg0_shape;
+    Shape arg1_shape;
+    Shape out_shape;
+};
+
+using NumpyBroadcastBinopParallelTest = ::testing::TestWithParam<BroadcastBinopParams>;
+
+TEST_P(NumpyBroadcastBinopParallelTest, MatchesSequential) {
+    const auto& params = GetParam();
+    const auto arg0 = iota_data<int64_t>(params.arg0_shape, 1);
+    const auto arg1 = iota_data<int64_t>(params.arg1_shape, 1000);
+    auto sub = [](int64_t a, int64_t b) {
+        return a - 3 * b;
+    };
+
+    std::vector<int64_t> expected(shape_size(params.out_shape));
+    ov::reference::internal::numpy_broadcast_binop_seq(arg0.data(),
+                                                       arg1.data(),
+                                                       expected.data(),
+                                                       params.arg0_shape,
+                                                       params.arg1_shape,
+                                                       sub);
+    std::vector<int64_t> actual(shape_size(params.out_shape), -1);
+    ov::reference::numpy_broadcast_binop(arg0.data(),
+                                         arg1.data(),
+                                         actual.data(),
+                                         params.arg0_shape,
+                                         params.arg1_shape,
+                                         sub);
+    ASSERT_EQ(expected, actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(reference,
+                         NumpyBroadcastBinopParallelTest,
+                         ::testing::Values(
+                             // leading unit dimensions, the split axis is not divisible by the threads number
+                             BroadcastBinopParams{{1, 1, 97, 1000}, {1000}, {1, 1, 97, 1000}},
+                             // ranks differ, both inputs are split
+                             BroadcastBinopParams{{64, 1, 700}, {1, 1, 64, 3, 700}, {1, 1, 64, 3, 700}},
+                             // the split axis is broadcast in the second input
+                             BroadcastBinopParams{{1, 5003, 1}, {1, 1, 13}, {1, 5003, 13}},
+                             // the split axis is broadcast in the first input
+                             BroadcastBinopParams{{1, 1, 13}, {1, 5003, 1}, {1, 5003, 13}},
+                             // scalar input
+                             BroadcastBinopParams{{70001}, {}, {70001}},
+                             // below the threshold
+                             BroadcastBinopParams{{2, 3}, {3}, {2, 3}}));
+
+TEST(ConvertParallelTest, FloatToFloat16) {
+    const size_t count = (1 << 16) * 5 + 17;
+    std::vector<float> src(count);
+    for (size_t i = 0; i < count; ++i) {
+        src[i] = static_cast<float>(i % 4099) * 0.25f - 500.0f;
+    }
+    std::vector<ov::float16> dst(count);
+    ov::reference::convert(src.data(), dst.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(dst[i], ov::float16(src[i])) << "at " << i;
+    }
+}
+
+TEST(ConvertParallelTest, U8ToFloat16) {
+    const size_t count = (1 << 16) * 3 + 5;
+    std::vector<uint8_t> src(count);
+    for (size_t i = 0; i < count; ++i) {
+        src[i] = static_cast<uint8_t>(i * 7);
+    }
+    std::vector<ov::float16> dst(count);
+    ov::reference::convert(src.data(), dst.data(), count);
+    for (size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(static_cast<float>(dst[i]), static_cast<float>(src[i])) << "at " << i;
+    }
+}
+
+TEST(GatherParallelTest, BatchDimsWithNegativeAndOutOfBoundIndices) {
+    const Shape data_shape{3, 4, 50, 7};
+    const Shape indices_shape{3, 301};
+    const Shape out_shape{3, 4, 301, 7};
+    const size_t axis = 2;
+    const size_t batch_dims = 1;
+    const auto data = iota_data<float>(data_shape, 1.0f);
+    std::vector<int32_t> indices(shape_size(indices_shape));
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = static_cast<int32_t>((i * 37) % 121) - 60;
+    }
+
+    std::vector<float> actual(shape_size(out_shape), -1.0f);
+    ov::reference::gather(data.data(),
+                          indices.data(),
+                          actual.data(),
+                          data_shape,
+                          indices_shape,
+                          out_shape,
+                          axis,
+                          batch_dims);
+
+    for (size_t b = 0; b < 3; ++b) {
+        for (size_t o = 0; o < 4; ++o) {
+            for (size_t i = 0; i < 301; ++i) {
+                int64_t idx = indices[b * 301 + i];
+                idx = idx < 0 ? idx + 50 : idx;
+                for (size_t k = 0; k < 7; ++k) {
+                    const float expected = (idx < 0 || idx >= 50) ? 0.0f : data[((b * 4 + o) * 50 + idx) * 7 + k];
+                    ASSERT_EQ(actual[((b * 4 + o) * 301 + i) * 7 + k], expected);
+                }
+            }
+        }
+    }
+}
+
+TEST(MatMulParallelTest, MatchesNaive) {
+    // 2D product split by rows and batched product split by batches with a broadcast batch dimension
+    for (const auto& shapes : std::vector<std::vector<Shape>>{{{201, 130}, {130, 91}, {201, 91}},
+                                                              {{3, 1, 41, 20}, {7, 20, 61}, {3, 7, 41, 61}}}) {
+        const auto& a_shape = shapes[0];
+        const auto& b_shape = shapes[1];
+        const auto& out_shape = shapes[2];
+        std::vector<float> a(shape_size(a_shape));
+        std::vector<float> b(shape_size(b_shape));
+        for (size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<float>(i % 7);
+        }
+        for (size_t i = 0; i < b.size(); ++i) {
+            b[i] = static_cast<float>(i % 5);
+        }
+
+        std::vector<float> actual(shape_size(out_shape));
+        ov::reference::matmul(a.data(), b.data(), actual.data(), a_shape, b_shape, out_shape, false, false);
+
+        const size_t I = a_shape[a_shape.size() - 2];
+        const size_t K = a_shape.back();
+        const size_t J = b_shape.back();
+        const size_t batches = shape_size(out_shape) / (I * J);
+        const size_t b_batches = b_shape.size() > 2 ? b_shape[0] : 1;
+        for (size_t n = 0; n < batches; ++n) {
+            const size_t a_batch = a_shape.size() > 2 ? n / b_batches : 0;
+            const size_t b_batch = b_shape.size() > 2 ? n % b_batches : 0;
+            for (size_t i = 0; i < I; ++i) {
+                for (size_t j = 0; j < J; ++j) {
+                    float expected = 0.0f;
+                    for (size_t k = 0; k < K; ++k) {
+                        expected += a[(a_batch * I + i) * K + k] * b[(b_batch * K + k) * J + j];
+                    }
+                    ASSERT_EQ(actual[(n * I + i) * J + j], expected);
+                }
+            }
+        }
+    }
+}
+}  // namespace parallel_kernels_test
@@ -23,6 +23,7 @@
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/util/common_util.hpp"
 #include "utils/common.hpp"
+#include "utils/external_data_prefetcher.hpp"
 
 using namespace ov;
 using namespace ::ONNX_NAMESPACE;
@@ -128,6 +129,13 @@ Graph::Graph(const std::string& model_dir,
             }
 
             initializers.emplace(initializer_tensor.name(), tensor);
+            if (m_mmap_cache && initializer_tensor.has_data_location() &&
+                initializer_tensor.data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+                detail::TensorExternalData external_data{initializer_tensor};
+                if (external_data.data_location() != detail::ORT_MEM_ADDR) {
+                    m_mmapped_initializers.emplace(initializer_tensor.name(), std::move(external_data));
+                }
+            }
             ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
             m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
         }
@@ -150,8 +158,19 @@ void Graph::convert_to_ov_nodes() {
     const float total = static_cast<float>(m_model->get_graph().node().size());
     unsigned int completed = 0u;
     std::map<std::string, uint64_t> op_statistics;
+    std::unordered_map<std::string, uint64_t> mmapped_sizes;
+    for (const auto& initializer : m_mmapped_initializers) {
+        mmapped_sizes.emplace(initializer.first, initializer.second.size());
+    }
+    detail::ExternalDataPrefetcher prefetcher{m_model->get_graph(),
+                                              std::move(mmapped_sizes),
+                                              [this](const std::string& name) {
+                                                  m_mmapped_initializers.at(name).prefetch_mmap_data(m_model_dir,
+                                                                                                     m_mmap_cache);
+                                              }};
     // Process ONNX graph nodes, convert to OV nodes
     for (const auto& node_proto : m_model->get_graph().node()) {
+        prefetcher.on_node(completed);
         if (m_extensions.telemetry) {
             std::string op_name =
                 (node_proto.has_domain() && node_proto.domain() != ""
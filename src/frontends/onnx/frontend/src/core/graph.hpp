@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "core/graph_cache.hpp"
@@ -94,6 +95,8 @@ private:
 
     std::string m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    // the initializers with the mmapped external data, read ahead while the consuming nodes are converted
+    std::unordered_map<std::string, detail::TensorExternalData> m_mmapped_initializers;
     OperatorsBridge m_ops_bridge;
 };
 
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/external_data_prefetcher.hpp"
+
+#include <algorithm>
+
+namespace ov {
+namespace frontend {
+namespace onnx {
+namespace detail {
+ExternalDataPrefetcher::ExternalDataPrefetcher(const GraphProto& graph,
+                                               std::unordered_map<std::string, uint64_t> initializers,
+                                               Prefetch prefetch,
+                                               size_t window_nodes,
+                                               uint64_t window_bytes)
+    : m_graph{graph},
+      m_pending{std::move(initializers)},
+      m_prefetch{std::move(prefetch)},
+      m_window_nodes{std::max<size_t>(window_nodes, 1)},
+      m_window_bytes{window_bytes} {}
+
+void ExternalDataPrefetcher::on_node(size_t node_idx) {
+    // the data of the converted nodes leaves the window
+    while (!m_window.empty() && m_window.front().first < node_idx) {
+        m_bytes_in_window -= m_window.front().second;
+        m_window.pop_front();
+    }
+    m_next_node = std::max(m_next_node, node_idx);
+
+    const auto num_nodes = static_cast<size_t>(m_graph.node_size());
+    while (!m_pending.empty() && m_next_node < num_nodes && m_next_node < node_idx + m_window_nodes &&
+           (m_next_node == node_idx || m_bytes_in_window < m_window_bytes)) {
+        uint64_t node_bytes = 0;
+        for (const auto& input : m_graph.node(static_cast<int>(m_next_node)).input()) {
+            const auto initializer = m_pending.find(input);
+            if (initializer == m_pending.end()) {
+                continue;
+            }
+            // each initializer is read ahead once, for its first consumer
+            node_bytes += initializer->second;
+            m_prefetch(initializer->first);
+            m_pending.erase(initializer);
+        }
+        m_window.emplace_back(m_next_node, node_bytes);
+        m_bytes_in_window += node_bytes;
+        ++m_next_node;
+    }
+}
+}  // namespace detail
+}  // namespace onnx
+}  // namespace frontend
+}  // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <onnx/onnx_pb.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace ov {
+namespace frontend {
+namespace onnx {
+namespace detail {
+using ::ONNX_NAMESPACE::GraphProto;
+
+/// \brief  Helper class which reads ahead the mmapped external data of the initializers in the order the graph nodes
+///         consume them. The read ahead is issued only for a bounded window of the next nodes, so paging in the
+///         weights overlaps with the conversion of the previous nodes, while the rest of the mapping stays lazy.
+class ExternalDataPrefetcher {
+public:
+    using Prefetch = std::function<void(const std::string&)>;
+
+    /// \param  graph           The graph whose nodes are converted.
+    /// \param  initializers    Sizes in bytes of the initializers with the mmapped external data, by name.
+    /// \param  prefetch        Issues the read ahead of the initializer with the given name.
+    /// \param  window_nodes    The maximal number of nodes, including the current one, whose data is read ahead.
+    /// \param  window_bytes    The maximal number of bytes read ahead. The data of the current node is read ahead
+    ///                         even if it is bigger.
+    ExternalDataPrefetcher(const GraphProto& graph,
+                           std::unordered_map<std::string, uint64_t> initializers,
+                           Prefetch prefetch,
+                           size_t window_nodes = 16,
+                           uint64_t window_bytes = 256 * 1024 * 1024);
+
+    /// \brief  Must be called before the node with the given index is converted, the indices must not decrease.
+    void on_node(size_t node_idx);
+
+private:
+    const GraphProto& m_graph;
+    std::unordered_map<std::string, uint64_t> m_pending;
+    Prefetch m_prefetch;
+    size_t m_window_nodes;
+    uint64_t m_window_bytes;
+    // the index of the first node whose data is not read ahead yet
+    size_t m_next_node = 0;
+    // the nodes whose data is read ahead, with the number of bytes
+    std::deque<std::pair<size_t, uint64_t>> m_window;
+    uint64_t m_bytes_in_window = 0;
+};
+}  // namespace detail
+}  // namespace onnx
+}  // namespace frontend
+}  // namespace ov
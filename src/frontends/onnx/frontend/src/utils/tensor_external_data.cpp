@@ -39,30 +39,50 @@ TensorExternalData::TensorExternalData(const std::string& location, size_t offse
     m_data_length = size;
 }
 
+namespace {
+std::filesystem::path mmap_data_path(const std::string& model_dir, const std::string& data_location) {
+    return model_dir.empty() ? ov::util::make_path(data_location)
+                             : ov::util::make_path(ov::util::path_join({model_dir, data_location}));
+}
+}  // namespace
+
 Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
                                                                      MappedMemoryHandles cache) const {
-    const auto full_path = model_dir.empty() ? ov::util::make_path(m_data_location)
-                                             : ov::util::make_path(ov::util::path_join({model_dir, m_data_location}));
-    const int64_t file_size = ov::util::file_size(full_path);
-    if (file_size <= 0 || m_data_length > static_cast<uint64_t>(file_size) ||
-        m_offset > static_cast<uint64_t>(file_size) - m_data_length) {
-        throw error::invalid_external_data{*this};
-    }
-    auto cached_mapped_memory = cache->find(ov::util::path_to_string(full_path));
+    const auto full_path = mmap_data_path(model_dir, m_data_location);
+    const auto cache_key = ov::util::path_to_string(full_path);
+    auto cached_mapped_memory = cache->find(cache_key);
     std::shared_ptr<ov::MappedMemory> mapped_memory;
     if (cached_mapped_memory != cache->end()) {
         mapped_memory = cached_mapped_memory->second;
     } else {
+        // each external file is checked and mapped once, the next tensors reuse the mapping
+        if (ov::util::file_size(full_path) <= 0) {
+            throw error::invalid_external_data{*this};
+        }
         mapped_memory = ov::load_mmap_object(full_path);
-        (*cache)[ov::util::path_to_string(full_path)] = mapped_memory;
+        (*cache)[cache_key] = mapped_memory;
     }
-    if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
+    const uint64_t file_size = mapped_memory->size();
+    if (file_size == 0 || m_data_length > file_size || m_offset > file_size - m_data_length) {
         throw error::invalid_external_data{*this};
     }
-    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
-        mapped_memory->data() + m_offset,
-        m_data_length > 0 ? m_data_length : static_cast<uint64_t>(file_size) - m_offset,
-        mapped_memory);
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(mapped_memory->data() + m_offset,
+                                                                                 data_length,
+                                                                                 mapped_memory);
+}
+
+void TensorExternalData::prefetch_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const {
+    const auto cached_mapped_memory = cache->find(ov::util::path_to_string(mmap_data_path(model_dir, m_data_location)));
+    if (cached_mapped_memory == cache->end()) {
+        return;
+    }
+    const auto& mapped_memory = cached_mapped_memory->second;
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset >= file_size) {
+        return;
+    }
+    mapped_memory->prefetch(m_offset, m_data_length > 0 ? m_data_length : file_size - m_offset);
 }
 
 Buffer<ov::AlignedBuffer> TensorExternalData::load_external_data(const std::string& model_dir) const {
@@ -43,6 +43,10 @@ public:
     /// \return     External binary data loaded into the SharedBuffer
     Buffer<ov::MappedMemory> load_external_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const;
 
+    /// \brief      Hints that the external data mapped by load_external_mmap_data will be accessed soon, so the
+    ///             pages are read in the background. Does nothing if the file is not mapped.
+    void prefetch_mmap_data(const std::string& model_dir, MappedMemoryHandles cache) const;
+
     /// \brief      Load external data from existing shared memory when m_data_location is ORT_MEM_ADDR
     ///
     /// \note       If reading data from existing shared memory fails,
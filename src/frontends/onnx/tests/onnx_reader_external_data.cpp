@@ -11,6 +11,7 @@
 #include <streambuf>
 #include <string>
 
+#include "../frontend/src/utils/external_data_prefetcher.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_case.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -434,3 +435,68 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_from_ORT_MEM_ADDR) {
 }
 
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
+
+namespace {
+// each node consumes the initializers with the given names
+::ONNX_NAMESPACE::GraphProto make_graph(const std::vector<std::vector<std::string>>& node_inputs) {
+    ::ONNX_NAMESPACE::GraphProto graph;
+    for (const auto& inputs : node_inputs) {
+        auto* node = graph.add_node();
+        node->set_op_type("Add");
+        for (const auto& input : inputs) {
+            node->add_input(input);
+        }
+    }
+    return graph;
+}
+}  // namespace
+
+TEST(ONNXExternalDataPrefetcher, reads_ahead_limited_number_of_nodes) {
+    const auto graph = make_graph({{"x", "w0"}, {"w1", "w0"}, {"w2"}, {"x"}, {"w3"}, {"w4"}});
+    std::vector<std::string> prefetched;
+    frontend::onnx::detail::ExternalDataPrefetcher prefetcher{
+        graph,
+        {{"w0", 100}, {"w1", 100}, {"w2", 100}, {"w3", 100}, {"w4", 100}},
+        [&prefetched](const std::string& name) {
+            prefetched.push_back(name);
+        },
+        3,
+        1000};
+
+    prefetcher.on_node(0);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2"}));
+    prefetcher.on_node(1);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2"}));
+    prefetcher.on_node(2);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2", "w3"}));
+    prefetcher.on_node(3);
+    prefetcher.on_node(4);
+    prefetcher.on_node(5);
+    // the shared initializer is read ahead once
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2", "w3", "w4"}));
+}
+
+TEST(ONNXExternalDataPrefetcher, reads_ahead_limited_number_of_bytes) {
+    const auto graph = make_graph({{"w0"}, {"w1"}, {"w2"}, {"w3"}, {"w4"}});
+    std::vector<std::string> prefetched;
+    frontend::onnx::detail::ExternalDataPrefetcher prefetcher{
+        graph,
+        {{"w0", 100}, {"w1", 100}, {"w2", 100}, {"w3", 1000}, {"w4", 100}},
+        [&prefetched](const std::string& name) {
+            prefetched.push_back(name);
+        },
+        16,
+        150};
+
+    prefetcher.on_node(0);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1"}));
+    prefetcher.on_node(1);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2"}));
+    prefetcher.on_node(2);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2", "w3"}));
+    prefetcher.on_node(3);
+    // the window is full with the data of the current node
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2", "w3"}));
+    prefetcher.on_node(4);
+    EXPECT_EQ(prefetched, (std::vector<std::string>{"w0", "w1", "w2", "w3", "w4"}));
+}
@@ -31,6 +31,11 @@ public:
         return false;
     }
 
+    bool has_variable_state(const std::string& node_name) const {
+        auto state = m_variables_state.find(node_name);
+        return state != m_variables_state.end() && !state->second.empty();
+    }
+
     void initialize_variable_state_map_for_node(const std::vector<std::string>& control_dependencies,
                                                 const std::vector<std::string>& data_dependencies,
                                                 const std::string& node_name) {
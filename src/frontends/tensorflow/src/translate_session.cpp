@@ -35,22 +35,25 @@ std::vector<T> reorder_ops_by_names(const std::vector<std::string>& names, const
                             "of names mismatches the number of operations.");
     std::vector<T> resulted_ops(ops.size(), nullptr);
 
+    // keep the first operation for each name
+    std::unordered_map<std::string, T> ops_by_name;
+    ops_by_name.reserve(ops.size());
     for (const auto& op : ops) {
-        const auto& op_name = op->get_friendly_name();
-        auto iter = std::find(names.begin(), names.end(), op_name);
-        FRONT_END_GENERAL_CHECK(iter != names.end(),
+        ops_by_name.emplace(op->get_friendly_name(), op);
+    }
+    std::unordered_set<std::string> names_set(names.begin(), names.end());
+    for (const auto& op : ops) {
+        FRONT_END_GENERAL_CHECK(names_set.count(op->get_friendly_name()) > 0,
                                 "[TensorFlow Frontend] Internal error: cannot perform reordering of operations. The "
                                 "requested name is not found among operations.");
     }
 
     size_t ind = 0;
     for (const auto& name : names) {
-        for (const auto& op : ops) {
-            if (op->get_friendly_name() == name) {
-                resulted_ops[ind] = op;
-                ind++;
-                break;
-            }
+        auto op_it = ops_by_name.find(name);
+        if (op_it != ops_by_name.end()) {
+            resulted_ops[ind] = op_it->second;
+            ind++;
         }
     }
     return resulted_ops;
@@ -501,8 +504,10 @@ void TranslateSession::translate_graph(const ov::frontend::InputModel::Ptr& inpu
                 // control dependency contains "^" in the beginning
                 control_dependencies_names.push_back(producer_name.substr(1));
                 continue;
-            } else {
-                // save all node names producing data
+            } else if (ov_variables_map->has_variable_state(producer_name)) {
+                // save node names producing data with variables state
+                // producers are translated before consumers so their state is final at this point
+                // and skipping stateless producers keeps this list short for large graphs
                 data_producer_names.push_back(producer_name);
             }
 
@@ -4,8 +4,11 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <fstream>
+#include <future>
 #include <string>
+#include <thread>
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
@@ -26,18 +29,19 @@ namespace tensorflow {
 
 void VariablesIndex::read_variables_index_block(std::ifstream& fs,
                                                 const VIBlock& index,
-                                                std::vector<char>& data,
-                                                uint32_t& offset,
-                                                uint32_t& offset_end) {
-    size_t block_size = index.m_size;
+                                                std::vector<char>& data) const {
     data.clear();
-    data.resize(block_size + BLOCK_TRAILER_SIZE);
+    data.resize(index.m_size + BLOCK_TRAILER_SIZE);
     FRONT_END_GENERAL_CHECK(index.m_offset <= m_variables_index_size,
                             "Block offset is bigger than variables index size");
     FRONT_END_GENERAL_CHECK(index.m_offset + data.size() <= m_variables_index_size,
                             "Block size is bigger than variables index size");
     fs.seekg(index.m_offset, std::ios::beg);
     fs.read(data.data(), data.size());
+}
+
+void VariablesIndex::unpack_variables_index_block(std::vector<char>& data, uint32_t& offset, uint32_t& offset_end) {
+    size_t block_size = data.size() - BLOCK_TRAILER_SIZE;
 #ifndef ENABLE_SNAPPY_COMPRESSION
     FRONT_END_GENERAL_CHECK(data[block_size] == 0, "Compressed files aren't supported");
 #else
@@ -84,7 +88,7 @@ void VariablesIndex::read_variables_index_pair(char*& ptr,
     ptr = value + val_length;
 }
 
-void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex) {
+void VariablesIndex::read_variables_index(std::ifstream& fs) {
     fs.seekg(0, std::ios::end);
     m_variables_index_size = fs.tellg();
 
@@ -97,7 +101,8 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
 
     uint32_t offset = 0, offset_end = 0;
 
-    read_variables_index_block(fs, footer.m_index, blockData, offset, offset_end);
+    read_variables_index_block(fs, footer.m_index, blockData);
+    unpack_variables_index_block(blockData, offset, offset_end);
     char *ptr = blockData.data() + offset, *ptr_end = blockData.data() + offset_end, *value = nullptr;
     std::string key = "";
     uint32_t valLength;
@@ -111,15 +116,59 @@ void VariablesIndex::read_variables_index(std::ifstream& fs, std::map<std::strin
         ptr = value + valLength;
     }
 
-    for (auto& block : secondLevel) {
-        read_variables_index_block(fs, block, blockData, offset, offset_end);
+    // File reading is sequential, decompression and parsing of the blocks is independent
+    m_index_blocks.resize(secondLevel.size());
+    for (size_t idx = 0; idx < secondLevel.size(); ++idx) {
+        read_variables_index_block(fs, secondLevel[idx], m_index_blocks[idx]);
+    }
 
-        key = "";
-        ptr = blockData.data() + offset;
-        ptr_end = blockData.data() + offset_end;
-        while (ptr < ptr_end) {
-            read_variables_index_pair(ptr, ptr_end, key, value, valLength);
-            varIndex[key] = std::vector<char>(value, value + valLength);
+    using IndexEntries = std::vector<std::pair<std::string, std::pair<const char*, size_t>>>;
+    std::vector<IndexEntries> block_entries(m_index_blocks.size());
+    auto parse_blocks = [&](size_t begin, size_t end) {
+        for (size_t idx = begin; idx < end; ++idx) {
+            uint32_t block_offset = 0, block_offset_end = 0;
+            unpack_variables_index_block(m_index_blocks[idx], block_offset, block_offset_end);
+
+            std::string block_key = "";
+            char* block_value = nullptr;
+            uint32_t block_val_length = 0;
+            char* block_ptr = m_index_blocks[idx].data() + block_offset;
+            const char* block_ptr_end = m_index_blocks[idx].data() + block_offset_end;
+            while (block_ptr < block_ptr_end) {
+                read_variables_index_pair(block_ptr, block_ptr_end, block_key, block_value, block_val_length);
+                block_entries[idx].emplace_back(block_key, std::make_pair(block_value, block_val_length));
+            }
+        }
+    };
+
+    const size_t workers =
+        std::min<size_t>(m_index_blocks.size(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+    if (workers > 1) {
+        const size_t chunk = (m_index_blocks.size() + workers - 1) / workers;
+        std::vector<std::future<void>> jobs;
+        for (size_t begin = chunk; begin < m_index_blocks.size(); begin += chunk) {
+            jobs.push_back(std::async(std::launch::async,
+                                      parse_blocks,
+                                      begin,
+                                      std::min(begin + chunk, m_index_blocks.size())));
+        }
+        parse_blocks(0, chunk);
+        // get() rethrows a parsing error of a worker
+        for (auto& job : jobs) {
+            job.get();
+        }
+    } else {
+        parse_blocks(0, m_index_blocks.size());
+    }
+
+    size_t total_entries = 0;
+    for (const auto& entries : block_entries) {
+        total_entries += entries.size();
+    }
+    m_variables_index.reserve(total_entries);
+    for (auto& entries : block_entries) {
+        for (auto& entry : entries) {
+            m_variables_index.insert_or_assign(std::move(entry.first), entry.second);
         }
     }
 }
@@ -129,7 +178,7 @@ void VariablesIndex::read_bundle_header() {
     FRONT_END_GENERAL_CHECK(item != m_variables_index.end(), "Bundle Header isn't found in index");
 
     ::tensorflow::BundleHeaderProto bundleHeader{};
-    FRONT_END_GENERAL_CHECK(bundleHeader.ParseFromArray(item->second.data(), static_cast<int>(item->second.size())),
+    FRONT_END_GENERAL_CHECK(bundleHeader.ParseFromArray(item->second.first, static_cast<int>(item->second.second)),
                             "Bundle Header: Cannot parse Bundle Header");
     FRONT_END_GENERAL_CHECK(bundleHeader.version().producer() == 1, "Bundle Header: Unsupported producer version");
     FRONT_END_GENERAL_CHECK(bundleHeader.version().min_consumer() == 0, "Bundle Header: Unsupported consumer version");
@@ -148,7 +197,7 @@ void VariablesIndex::read_checkpointable_object_graph() {
     }
 
     ::tensorflow::BundleEntryProto entry{};
-    FRONT_END_GENERAL_CHECK(entry.ParseFromArray(item->second.data(), static_cast<int>(item->second.size())),
+    FRONT_END_GENERAL_CHECK(entry.ParseFromArray(item->second.first, static_cast<int>(item->second.second)),
                             "CMO: Cannot parse Bundle Entry");
 
     FRONT_END_GENERAL_CHECK(entry.slices().empty(), "CMO: Slices are not supported");
@@ -156,19 +205,24 @@ void VariablesIndex::read_checkpointable_object_graph() {
     auto shard = m_data_files.find(entry.shard_id());
     FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
 
-    std::vector<char> data(entry.size());
+    std::vector<char> data;
     ::tensorflow::TrackableObjectGraph tog;
 
     // TODO: have to understand this offset
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
+    const char* srcPtr = nullptr;
     if (m_mmap_enabled) {
-        auto srcPtr = static_cast<char*>(shard->second.mmap->data() + entry.offset() + chg);
-        std::copy(srcPtr, srcPtr + entry.size() - chg, data.data());
+        // Object graph is parsed directly from the mapped shard
+        FRONT_END_GENERAL_CHECK(shard->second.mmap->size() >= static_cast<size_t>(entry.offset() + entry.size()),
+                                "CMO: Entry is out of bounds of mapped memory size");
+        srcPtr = shard->second.mmap->data() + entry.offset() + chg;
     } else {
+        data.resize(entry.size());
         shard->second.stream->seekg(entry.offset() + chg);
         shard->second.stream->read(data.data(), entry.size() - chg);
+        srcPtr = data.data();
     }
 
     // Might be need to remove this verification:
@@ -176,7 +230,7 @@ void VariablesIndex::read_checkpointable_object_graph() {
     // FRONT_END_GENERAL_CHECK(tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg), "CMO: Trackable
     // Object Graph couldn't be read");
 
-    tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    tog.ParseFromArray(srcPtr, static_cast<int>(entry.size()) - chg);
 
     for (const auto& node : tog.nodes()) {
         for (const auto& attr : node.attributes()) {
@@ -187,7 +241,8 @@ void VariablesIndex::read_checkpointable_object_graph() {
 
 bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string& path, const bool is_saved_model) {
     m_variables_index.clear();
-    read_variables_index(vi_stream, m_variables_index);
+    m_index_blocks.clear();
+    read_variables_index(vi_stream);
     read_bundle_header();
 
     std::vector<char> suffix(32);
@@ -216,7 +271,8 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring& path, const bool is_saved_model) {
     m_variables_index.clear();
-    read_variables_index(vi_stream, m_variables_index);
+    m_index_blocks.clear();
+    read_variables_index(vi_stream);
     read_bundle_header();
 
     std::vector<wchar_t> suffix(20);
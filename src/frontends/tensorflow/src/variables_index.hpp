@@ -5,6 +5,8 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
+#include <utility>
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/op/constant.hpp"
@@ -31,8 +33,10 @@ class VariablesIndex {
     size_t m_variables_index_size = 0;
     // Contains maximum amount of shards, used for creating correct extension
     int32_t m_total_shards = 0;
-    // Contains BundleEntryProto variables list, read from .index file
-    std::map<std::string, std::vector<char>> m_variables_index;
+    // Contains decoded data blocks of .index file, values of m_variables_index point into them
+    std::vector<std::vector<char>> m_index_blocks;
+    // Contains BundleEntryProto variables list, read from .index file, as (data, size) views of m_index_blocks
+    std::unordered_map<std::string, std::pair<const char*, size_t>> m_variables_index;
     // List of opened data files for using with BundleEntryProto
     std::map<int32_t, VariableStorage> m_data_files;
     // List of mapped variables which could be read using TrackableObjectGraph
@@ -42,6 +46,9 @@ class VariablesIndex {
 
 public:
     VariablesIndex(bool mmap_enabled = false) : m_mmap_enabled(mmap_enabled) {}
+    // Stored variables point into the owned index blocks, so the index isn't copyable
+    VariablesIndex(const VariablesIndex&) = delete;
+    VariablesIndex& operator=(const VariablesIndex&) = delete;
     /// \brief Returns mmap_enabled state.
     /// \returns True if mmap is enabled, false otherwise
     bool is_mmap_enabled(void) const {
@@ -73,10 +80,10 @@ public:
             return false;
         }
         if (data != nullptr) {
-            *data = varItem->second.data();
+            *data = varItem->second.first;
         }
         if (size != nullptr) {
-            *size = varItem->second.size();
+            *size = varItem->second.second;
         }
         return true;
     }
@@ -148,32 +155,31 @@ public:
                                    HashTableKeysValuesMap& hash_table_values_map);
 
 private:
-    /// \brief Reads block structure of .index file
+    /// \brief Reads raw data of a block of .index file, including the block trailer
     /// \param[in,out] fs Filestream of .index file, position in file will be updated
     /// \param[in] index Variables index block which stores information about block
     /// \param[out] data Block data will be read
+    void read_variables_index_block(std::ifstream& fs, const VIBlock& index, std::vector<char>& data) const;
+    /// \brief Decompresses raw block data in place (if needed) and finds the range of stored key=value pairs
+    /// \param[in,out] data Raw block data, read by read_variables_index_block
     /// \param[out] offset Offset of block start
     /// \param[out] offset_end Offset of block end
-    void read_variables_index_block(std::ifstream& fs,
-                                    const VIBlock& index,
-                                    std::vector<char>& data,
-                                    uint32_t& offset,
-                                    uint32_t& offset_end);
+    static void unpack_variables_index_block(std::vector<char>& data, uint32_t& offset, uint32_t& offset_end);
     /// \brief Reads key=value pair from provided pointer
     /// \param[in,out] ptr Actual pointer, will be moved to the end of read pair (to read next)
     /// \param[in] ptr_end End of memory which shouldn't be passed in case of broken structure
     /// \param[out] key Key name
     /// \param[out] value Stored value for key (isn't a pure string, data block)
     /// \param[out] val_length Length of read value
-    void read_variables_index_pair(char*& ptr,
-                                   const char* ptr_end,
-                                   std::string& key,
-                                   char*& value,
-                                   uint32_t& val_length);
-    /// \brief Reads .index file and stores key=value map in provided varIndex
+    static void read_variables_index_pair(char*& ptr,
+                                          const char* ptr_end,
+                                          std::string& key,
+                                          char*& value,
+                                          uint32_t& val_length);
+    /// \brief Reads .index file and stores key=value map in m_variables_index.
+    /// Data blocks are read sequentially and parsed in parallel, values aren't copied out of the blocks.
     /// \param[in,out] fs Filestream should be parsed. Position in file will be updated
-    /// \param[out] varIndex Variables indx (key=value) from given filestream
-    void read_variables_index(std::ifstream& fs, std::map<std::string, std::vector<char>>& varIndex);
+    void read_variables_index(std::ifstream& fs);
     /// \brief Reads bundle header if it is available. Checks version and saves info about amount of shards
     void read_bundle_header();
     /// \brief Reads key=value map from stored _CHECKPOINTABLE_OBJECT_GRAPH variable
@@ -842,3 +842,18 @@ TEST_F(FrontEndConversionWithReferenceTestsF, UnitializedVariableV2AsInput) {
         model_ref = make_shared<Model>(OutputVector{mul}, ParameterVector{x, var});
     }
 }
+
+TEST_F(FrontEndConversionWithReferenceTestsF, ModelWithLongChain) {
+    // The test aims to check conversion of a deep chain of operations
+    // It must not take quadratic time in a number of nodes
+    { model = convert_model("long_chain/long_chain.pb"); }
+    {
+        auto x = make_shared<v0::Parameter>(f32, Shape{2, 3});
+        Output<Node> y = x;
+        for (size_t ind = 0; ind < 5000; ++ind) {
+            auto one = make_shared<v0::Constant>(f32, Shape{}, 1.0f);
+            y = make_shared<v1::Add>(y, one);
+        }
+        model_ref = make_shared<Model>(OutputVector{y}, ParameterVector{x});
+    }
+}
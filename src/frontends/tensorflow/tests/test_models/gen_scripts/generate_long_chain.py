@@ -0,0 +1,22 @@
+# Copyright (C) 2018-2026 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import sys
+
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model
+with tf.compat.v1.Session() as sess:
+    x = tf.compat.v1.placeholder(tf.float32, [2, 3], 'x')
+    y = x
+    # a deep chain of operations checks that translation time grows linearly with a number of nodes
+    for ind in range(5000):
+        y = tf.add(y, tf.constant(1.0, dtype=tf.float32), name="add_{}".format(ind))
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "long_chain"), 'long_chain.pb', False)
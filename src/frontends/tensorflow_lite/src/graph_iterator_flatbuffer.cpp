@@ -10,21 +10,49 @@
 
 using namespace ov::frontend::tensorflow_lite;
 
+namespace {
+// Keeps the file content read into memory when mmap is disabled
+class ReadFileMemory : public ov::MappedMemory {
+public:
+    explicit ReadFileMemory(std::vector<char>&& data) : m_data(std::move(data)) {}
+
+    char* data() noexcept override {
+        return m_data.data();
+    }
+
+    size_t size() const noexcept override {
+        return m_data.size();
+    }
+
+private:
+    std::vector<char> m_data;
+};
+}  // namespace
+
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
-    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path)) {}
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled)
+    : GraphIteratorFlatBuffer(ov::util::wstring_to_string(path), mmap_enabled) {}
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled) {
+    if (mmap_enabled) {
+        // Constant tensors refer to the mapped file instead of copying it
+        m_data = ov::load_mmap_object(ov::util::make_path(path));
+    } else {
+        std::ifstream model_file(path, std::ios::binary | std::ios::in);
+        FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+        model_file.seekg(0, std::ios::end);
+        std::vector<char> data(static_cast<size_t>(model_file.tellg()));
+        model_file.seekg(0, std::ios::beg);
+        model_file.read(data.data(), data.size());
+        FRONT_END_GENERAL_CHECK(model_file, "Cannot read model file: ", path);
+        m_data = std::make_shared<ReadFileMemory>(std::move(data));
+    }
+    FRONT_END_GENERAL_CHECK(m_data && m_data->data(), "Cannot read model file: ", path);
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(m_data->data());
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -46,6 +74,7 @@ std::shared_ptr<GraphIterator> GraphIteratorFlatBuffer::get_subgraph(size_t idx)
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_data = m_data;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
@@ -15,6 +15,7 @@
 #include "openvino/frontend/tensorflow_lite/graph_iterator.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -38,7 +39,8 @@ std::basic_string<wchar_t> get_model_extension<wchar_t>();
 
 class GraphIteratorFlatBuffer : public GraphIterator {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    // Model data, either mapped or read file content, shared with sub-graph iterators and Constants
+    std::shared_ptr<ov::MappedMemory> m_data;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -46,10 +48,10 @@ class GraphIteratorFlatBuffer : public GraphIterator {
 
 public:
     GraphIteratorFlatBuffer() = default;
-    explicit GraphIteratorFlatBuffer(const std::string& path);
+    explicit GraphIteratorFlatBuffer(const std::string& path, bool mmap_enabled = true);
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    explicit GraphIteratorFlatBuffer(const std::wstring& path);
+    explicit GraphIteratorFlatBuffer(const std::wstring& path, bool mmap_enabled = true);
 #endif
 
     using Ptr = std::shared_ptr<GraphIteratorFlatBuffer>;
@@ -113,6 +115,11 @@ public:
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderBase> get_decoder() const override;
 
+    /// \brief Returns memory holding the model, tensor buffers pointing into it can be shared without a copy
+    const std::shared_ptr<ov::MappedMemory>& get_model_data() const {
+        return m_data;
+    }
+
     /// \brief Returns the number of sub-graphs that can be enumerated with get_subgraph
     size_t get_subgraph_size() const override;
 
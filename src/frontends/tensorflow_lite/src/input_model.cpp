@@ -7,8 +7,11 @@
 #include <iterator>
 #include <queue>
 
+#include "graph_iterator_flatbuffer.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -30,6 +33,27 @@ std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace> decode_tensor_pl
     return tensor_place;
 }
 
+// Creates Constant sharing the model memory if data points into it, otherwise Constant owns a copy of data
+std::shared_ptr<ov::op::v0::Constant> create_tensor_constant(const ov::element::Type& type,
+                                                             const ov::Shape& shape,
+                                                             const void* data,
+                                                             const std::shared_ptr<ov::MappedMemory>& model_data) {
+    if (model_data && type != ov::element::string) {
+        const auto model_begin = reinterpret_cast<uintptr_t>(model_data->data());
+        const auto model_end = model_begin + model_data->size();
+        const auto data_begin = reinterpret_cast<uintptr_t>(data);
+        const auto byte_size = ov::util::get_memory_size(type, ov::shape_size(shape));
+        if (data_begin >= model_begin && data_begin <= model_end && byte_size <= model_end - data_begin) {
+            auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                static_cast<char*>(const_cast<void*>(data)),
+                byte_size,
+                model_data);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+
 std::shared_ptr<ov::frontend::tensorflow_lite::TensorLitePlace> decode_input_tensor(
     const std::shared_ptr<ov::frontend::tensorflow_lite::DecoderBaseOperation>& decoder,
     size_t idx,
@@ -113,6 +137,11 @@ void InputModel::InputModelTFLiteImpl::load_model() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
     m_op_places.reserve(m_graph_iterator->size());
+    // constants of flatbuffer models refer to the model memory without a copy
+    std::shared_ptr<ov::MappedMemory> model_data;
+    if (auto flatbuffer_iterator = std::dynamic_pointer_cast<GraphIteratorFlatBuffer>(m_graph_iterator)) {
+        model_data = flatbuffer_iterator->get_model_data();
+    }
     for (; !m_graph_iterator->is_end(); m_graph_iterator->next()) {
         const auto& decoder = m_graph_iterator->get_decoder();
 
@@ -145,9 +174,10 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_tensor_constant(place->get_element_type(),
+                                                           place->get_partial_shape().to_shape(),
+                                                           data,
+                                                           model_data);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
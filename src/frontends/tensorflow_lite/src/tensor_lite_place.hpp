@@ -28,7 +28,7 @@ public:
         : ov::frontend::tensorflow::TensorPlace(input_model, pshape, type, names),
           m_quantization(quantization),
           m_sparsity(sparsity),
-          m_data(m_sparsity == nullptr || m_sparsity->is_disabled() ? data : m_sparsity->dense_data()) {};
+          m_data(data) {};
 
     void translate(ov::Output<ov::Node>& output, bool convert_tensor_attrs_to_nodes = false);
 
@@ -53,7 +53,11 @@ public:
         m_output_idx = idx;
     }
 
+    /// \brief Returns tensor data, a sparse tensor is densified on the first request
     const void* get_data() const {
+        if (m_sparsity != nullptr && !m_sparsity->is_disabled()) {
+            return m_sparsity->dense_data();
+        }
         return m_data;
     }
 
@@ -12,7 +12,9 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <limits>
 #include <map>
+#include <numeric>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -176,6 +178,68 @@ public:
         return _min_required;
     }
 
+    /**
+     * @brief Solve memory location with best-fit placement.
+     *
+     * Boxes are placed by size (biggest first), then by live time (longest first).
+     * Each box takes the smallest free gap among the boxes alive at the same time, or the top of them
+     * if no gap fits. The optional refinement moves the box that defines the peak earlier in the placement
+     * order and keeps the new order if the peak decreases.
+     * Should not be combined with solve() on the same object, as solve() modifies the boxes.
+     *
+     * @param refinement_iterations Max number of alternative placement orders to evaluate
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solve_best_fit(size_t refinement_iterations = 0) {
+        std::vector<size_t> order(_boxes.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [this](size_t l, size_t r) {
+            const Box& lb = _boxes[l];
+            const Box& rb = _boxes[r];
+            if (lb.size != rb.size)
+                return lb.size > rb.size;
+            return lb.finish - lb.start > rb.finish - rb.start;
+        });
+
+        std::vector<int64_t> offsets;
+        int64_t min_required = place_best_fit(order, offsets);
+
+        size_t iterations = 0;
+        bool improved = true;
+        while (improved && iterations < refinement_iterations) {
+            improved = false;
+            // the last placed box which reaches the peak
+            size_t peak_pos = 0;
+            for (size_t pos = 0; pos < order.size(); pos++) {
+                if (offsets[order[pos]] + _boxes[order[pos]].size == min_required)
+                    peak_pos = pos;
+            }
+
+            for (size_t pos = 0; pos < peak_pos && iterations < refinement_iterations; pos++, iterations++) {
+                auto candidate_order = order;
+                std::rotate(candidate_order.begin() + pos,
+                            candidate_order.begin() + peak_pos,
+                            candidate_order.begin() + peak_pos + 1);
+                std::vector<int64_t> candidate_offsets;
+                const int64_t candidate_required = place_best_fit(candidate_order, candidate_offsets);
+                if (candidate_required < min_required) {
+                    order = std::move(candidate_order);
+                    offsets = std::move(candidate_offsets);
+                    min_required = candidate_required;
+                    improved = true;
+                    iterations++;
+                    break;
+                }
+            }
+        }
+
+        _offsets.clear();
+        for (size_t i = 0; i < _boxes.size(); i++)
+            _offsets[_boxes[i].id] = offsets[i];
+
+        return min_required;
+    }
+
     /** Provides calculated offset for specified box id */
     int64_t get_offset(int id) const {
         auto res = _offsets.find(id);
@@ -204,6 +268,47 @@ private:
     int64_t _depth = -1;
     int _time_duration = -1;
 
+    /** Places boxes in the provided order, offsets are indexed as _boxes. Returns the peak. */
+    int64_t place_best_fit(const std::vector<size_t>& order, std::vector<int64_t>& offsets) const {
+        offsets.assign(_boxes.size(), 0);
+        // placed boxes sorted by offset, so the gaps between the live ones are found in a single pass
+        std::vector<size_t> placed;
+        placed.reserve(order.size());
+
+        int64_t min_required = 0;
+        for (size_t idx : order) {
+            const Box& box = _boxes[idx];
+
+            int64_t best_offset = -1;
+            int64_t best_gap = std::numeric_limits<int64_t>::max();
+            int64_t free_from = 0;
+            for (size_t p : placed) {
+                const Box& other = _boxes[p];
+                if (box.start > other.finish || other.start > box.finish)
+                    continue;
+                const int64_t gap = offsets[p] - free_from;
+                if (box.size <= gap && gap < best_gap) {
+                    best_gap = gap;
+                    best_offset = free_from;
+                }
+                free_from = std::max(free_from, offsets[p] + other.size);
+            }
+            if (best_offset == -1)
+                best_offset = free_from;
+
+            offsets[idx] = best_offset;
+            placed.insert(std::upper_bound(placed.begin(),
+                                           placed.end(),
+                                           best_offset,
+                                           [&offsets](int64_t offset, size_t p) {
+                                               return offset < offsets[p];
+                                           }),
+                          idx);
+            min_required = std::max(min_required, best_offset + box.size);
+        }
+        return min_required;
+    }
+
     void calc_depth() {
         int64_t top_depth = 0;
         int64_t depth = 0;
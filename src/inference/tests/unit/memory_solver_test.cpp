@@ -336,3 +336,72 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+//  |            __________
+//  |   ____    |_3________|
+//  |  |_4__|_____ |    |
+//  |__|_2________||_1__|___
+//      2  3  4  5  6  7  8
+TEST(MemSolverTest, BestFitInefficiency) {
+    int n = 0;
+    std::vector<Box> boxes{
+        {6, 7, 3, n++},
+        {2, 5, 2, n++},
+        {5, 8, 2, n++},
+        {2, 3, 2, n++},
+    };
+
+    ov::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve_best_fit(), 5);
+    EXPECT_EQ(ms.max_depth(), 5);
+}
+
+TEST(MemSolverTest, BestFitNotWorseThanGreedy) {
+    std::vector<std::vector<Box>> cases{
+        {{6, 7, 4, 0}, {2, 5, 3, 1}, {5, 8, 2, 2}, {2, 3, 2, 3}},
+        {{0, 1, 2, 0}, {1, 2, 2, 1}, {3, 3, 2, 2}, {3, 5, 2, 3}, {3, 4, 2, 4}},
+        {{0, 1, 2, 0}, {1, -1, 2, 1}, {3, 3, 2, 2}, {3, -1, 2, 3}, {3, 4, 2, 4}},
+        {{4, 8, 1, 0}, {6, 7, 3, 1}, {2, 3, 3, 2}, {2, 4, 2, 3}},
+        {{2, 3, 1, 0}, {3, 4, 1, 1}, {4, 6, 2, 2}, {6, 7, 3, 3}},
+    };
+
+    // pseudo random boxes
+    std::vector<Box> random_boxes;
+    uint32_t seed = 7;
+    for (int i = 0; i < 64; i++) {
+        seed = seed * 1103515245 + 12345;
+        const int start = static_cast<int>(seed % 40);
+        seed = seed * 1103515245 + 12345;
+        const int finish = start + static_cast<int>(seed % 8);
+        seed = seed * 1103515245 + 12345;
+        random_boxes.push_back({start, finish, 1 + static_cast<int64_t>(seed % 100), i});
+    }
+    cases.push_back(random_boxes);
+
+    for (const auto& boxes : cases) {
+        ov::MemorySolver greedy(boxes);
+        const int64_t greedy_size = greedy.solve();
+
+        for (size_t iterations : {0, 64}) {
+            ov::MemorySolver ms(boxes);
+            const int64_t size = ms.solve_best_fit(iterations);
+            EXPECT_LE(size, greedy_size);
+            EXPECT_GE(size, ms.max_depth());
+
+            std::vector<Box> normalized = boxes;
+            ov::MemorySolver::normalize_boxes(normalized);
+            for (size_t i = 0; i < normalized.size(); i++) {
+                for (size_t j = i + 1; j < normalized.size(); j++) {
+                    const auto& box1 = normalized[i];
+                    const auto& box2 = normalized[j];
+                    int64_t off1 = ms.get_offset(static_cast<int>(box1.id));
+                    int64_t off2 = ms.get_offset(static_cast<int>(box2.id));
+                    ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish || off1 + box1.size <= off2 ||
+                                off1 >= off2 + box2.size)
+                        << "Box overlapping is detected";
+                    ASSERT_LE(off1 + box1.size, size);
+                }
+            }
+        }
+    }
+}
@@ -82,6 +82,7 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.numaInterleaveWeights, m_cfg.hugePages != ov::intel_cpu::HugePagesMode::DISABLED),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -210,7 +211,7 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
-                graphLock._graph.Activate();
+                graphLock._graph.Activate(m_cfg.lazyWeights);
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -475,6 +475,57 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::sparse_attn_local_blocks.name() ||
+                   key == ov::intel_cpu::sparse_attn_sink_tokens.name() ||
+                   key == ov::intel_cpu::sparse_attn_global_stride.name()) {
+            int32_t value = -1;
+            try {
+                value = val.as<int32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", key);
+            }
+            if (value < 0) {
+                OPENVINO_THROW("Wrong value ", value, " for property key ", key, ". Expected non-negative number");
+            }
+            if (key == ov::intel_cpu::sparse_attn_local_blocks.name()) {
+                sparseAttnLocalBlocks = static_cast<size_t>(value);
+            } else if (key == ov::intel_cpu::sparse_attn_sink_tokens.name()) {
+                sparseAttnSinkTokens = static_cast<size_t>(value);
+            } else {
+                sparseAttnGlobalStride = static_cast<size_t>(value);
+            }
+        } else if (key == ov::intel_cpu::numa_memory_policy.name()) {
+            try {
+                numaMemoryPolicy = val.as<ov::intel_cpu::NumaMemoryPolicy>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::numa_memory_policy.name(),
+                               ". Expected DEFAULT/BIND/FIRST_TOUCH");
+            }
+        } else if (key == ov::intel_cpu::numa_interleave_weights.name()) {
+            try {
+                numaInterleaveWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::numa_interleave_weights.name());
+            }
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            try {
+                hugePages = val.as<ov::intel_cpu::HugePagesMode>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::huge_pages.name(),
+                               ". Expected DISABLED/TRANSPARENT/EXPLICIT");
+            }
+        } else if (key == ov::intel_cpu::lazy_weights.name()) {
+            try {
+                lazyWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::lazy_weights.name());
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
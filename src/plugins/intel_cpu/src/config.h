@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -87,6 +88,13 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    size_t sparseAttnLocalBlocks = 0UL;
+    size_t sparseAttnSinkTokens = 0UL;
+    size_t sparseAttnGlobalStride = 0UL;
+    ov::intel_cpu::NumaMemoryPolicy numaMemoryPolicy = ov::intel_cpu::NumaMemoryPolicy::DEFAULT;
+    bool numaInterleaveWeights = false;
+    ov::intel_cpu::HugePagesMode hugePages = ov::intel_cpu::HugePagesMode::DISABLED;
+    bool lazyWeights = false;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -14,9 +14,11 @@
 #include <common/nstl.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
@@ -38,9 +40,12 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
+#    include <fstream>
+#    include <sstream>
 #    include <utility>
 #endif
 
@@ -56,6 +61,55 @@ BlockedMemoryDescPtr IMemory::getDescWithType<BlockedMemoryDesc>() const {
 }
 
 namespace {
+constexpr size_t hugePageSize = 2UL * 1024 * 1024;
+
+#if defined(__linux__)
+#    if !defined(MAP_HUGE_SHIFT)
+#        define MAP_HUGE_SHIFT 26
+#    endif
+constexpr size_t gigaHugePageSize = 1024UL * 1024 * 1024;
+
+void* mmap_huge_pages(size_t size, size_t page_size) {
+    const int page_shift = page_size == gigaHugePageSize ? 30 : 21;
+    void* ptr = mmap(nullptr,
+                     size,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT),
+                     -1,
+                     0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+// 1 GB pages are used only when rounding the size up to them wastes little memory, otherwise 2 MB pages are used
+constexpr size_t gigaHugePageMaxWaste = gigaHugePageSize / 16;
+
+// returns the mapped pointer and the mapped size, or nullptr if no explicit huge pages are available
+std::pair<void*, size_t> mmap_huge_pages(size_t size) {
+    const size_t giga_mapped_size = div_up(size, gigaHugePageSize) * gigaHugePageSize;
+    if (size >= gigaHugePageSize && giga_mapped_size - size <= gigaHugePageMaxWaste) {
+        if (auto* ptr = mmap_huge_pages(giga_mapped_size, gigaHugePageSize)) {
+            return {ptr, giga_mapped_size};
+        }
+    }
+    const size_t mapped_size = div_up(size, hugePageSize) * hugePageSize;
+    if (auto* ptr = mmap_huge_pages(mapped_size, hugePageSize)) {
+        return {ptr, mapped_size};
+    }
+    DEBUG_LOG("Explicit huge pages are not available: ", strerror(errno));
+    return {nullptr, 0};
+}
+
+void munmap_huge_pages(void* ptr, size_t size) {
+    munmap(ptr, size);
+}
+#else
+std::pair<void*, size_t> mmap_huge_pages([[maybe_unused]] size_t size) {
+    return {nullptr, 0};
+}
+
+void munmap_huge_pages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) {}
+#endif
+
 inline void setSubnormalsToZeroAndbf16Saturation(float* data, size_t size, bool ftz, bool bf16saturation) {
     auto* u32data = reinterpret_cast<uint32_t*>(data);
     auto* floatdata = data;
@@ -253,17 +307,32 @@ bool MemoryBlockWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void* ptr = dnnl::impl::malloc(size, cacheLineSize);
-        OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
+        const bool useHugePages = m_hugePages != ov::intel_cpu::HugePagesMode::DISABLED && size >= hugePageSize;
+        void* ptr = nullptr;
+        if (useHugePages && m_hugePages == ov::intel_cpu::HugePagesMode::EXPLICIT) {
+            auto [mapped_ptr, mapped_size] = mmap_huge_pages(size);
+            if (mapped_ptr) {
+                ptr = mapped_ptr;
+                m_data = decltype(m_data)(ptr, [mapped_size = mapped_size](void* p) {
+                    munmap_huge_pages(p, mapped_size);
+                });
+            }
+        }
+        if (!ptr) {
+            // transparent huge pages can be used only for huge page aligned regions
+            ptr = dnnl::impl::malloc(size, useHugePages ? hugePageSize : cacheLineSize);
+            OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
+            m_data = decltype(m_data)(ptr, destroy);
+            if (useHugePages && !madvise_huge_pages(ptr, size)) {
+                DEBUG_LOG("MemoryBlockWithReuse failed to advise huge pages for ", size, " bytes\n");
+            }
+        }
         m_memUpperBound = size;
         m_useExternalStorage = false;
-        m_data = decltype(m_data)(ptr, destroy);
         sizeChanged = true;
 
-        if (numa_node >= 0) {
-            if (!mbind_move(ptr, size, numa_node)) {
-                DEBUG_LOG("MemoryBlockWithReuse move_memory to node ", numa_node, " failed\n");
-            }
+        if (!apply_numa_placement(ptr, size, m_numaPlacement)) {
+            DEBUG_LOG("MemoryBlockWithReuse failed to apply NUMA placement for node ", m_numaPlacement.node, "\n");
         }
     }
     return sizeChanged;
@@ -557,15 +626,21 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
 }
 
 #if defined(__linux__)
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
 #        define NR_mbind __NR_mbind
 #    endif
+#    if !defined(__NR_move_pages)
+#        define NR_move_pages 279
+#    else
+#        define NR_move_pages __NR_move_pages
+#    endif
 static int64_t mbind(void* start, uint64_t len, int mode, const uint64_t* nmask, uint64_t maxnode, unsigned flags) {
     return syscall(NR_mbind,
                    reinterpret_cast<uint64_t>(start),
@@ -575,6 +650,17 @@ static int64_t mbind(void* start, uint64_t len, int mode, const uint64_t* nmask,
                    maxnode,
                    flags);
 }
+
+// with nodes == nullptr the call does not move anything, but reports the node of each page in status
+static int64_t query_pages(uint64_t count, void** pages, int* status) {
+    return syscall(NR_move_pages,
+                   0,
+                   count,
+                   reinterpret_cast<uint64_t>(pages),
+                   static_cast<uint64_t>(0),
+                   reinterpret_cast<uint64_t>(status),
+                   0);
+}
 #endif
 
 #if defined(__linux__)
@@ -602,11 +688,211 @@ bool mbind_move(void* data, size_t size, int targetNode) {
     }
     return true;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    auto numa_nodes = ov::get_available_numa_nodes();
+    if (numa_nodes.size() < 2) {
+        return true;
+    }
+    auto pagesize = getpagesize();
+    auto page_count = (size + pagesize - 1) / pagesize;
+    auto* pages = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    uint64_t mask = 0;
+    for (auto node : numa_nodes) {
+        auto realNode = ov::get_org_numa_id(node);
+        if (realNode >= 0 && realNode < static_cast<int>(sizeof(mask) * 8)) {
+            mask |= 1UL << realNode;
+        }
+    }
+
+    auto rc = mbind(pages, page_count * pagesize, MPOL_INTERLEAVE, &mask, sizeof(mask) * 8, MPOL_MF_MOVE);
+    if (rc < 0) {
+        DEBUG_LOG("mbind interleave failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+std::map<int, size_t> numa_resident_bytes(const void* data, size_t size) {
+    std::map<int, size_t> retVal;
+    if (!data || size == 0) {
+        return retVal;
+    }
+    const size_t pagesize = getpagesize();
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    // query in chunks to limit the temporary buffers size
+    constexpr size_t chunk = 1024;
+    std::vector<void*> pages(chunk);
+    std::vector<int> status(chunk);
+    for (auto addr = begin; addr < end;) {
+        size_t count = 0;
+        for (; count < chunk && addr < end; ++count, addr += pagesize) {
+            pages[count] = reinterpret_cast<void*>(addr);  // NOLINT(performance-no-int-to-ptr)
+        }
+        if (query_pages(count, pages.data(), status.data()) < 0) {
+            DEBUG_LOG("move_pages query failed: ", strerror(errno));
+            return {};
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (status[i] >= 0) {
+                retVal[status[i]] += pagesize;
+            }
+        }
+    }
+    return retVal;
+}
+
+bool madvise_huge_pages(void* data, size_t size) {
+    const size_t pagesize = getpagesize();
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    auto* pages = reinterpret_cast<void*>(begin);  // NOLINT(performance-no-int-to-ptr)
+    if (madvise(pages, end - begin, MADV_HUGEPAGE) != 0) {
+        DEBUG_LOG("madvise huge pages failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool madvise_will_need(const void* data, size_t size) {
+    const size_t pagesize = getpagesize();
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    auto* pages = reinterpret_cast<void*>(begin);  // NOLINT(performance-no-int-to-ptr)
+    if (madvise(pages, end - begin, MADV_WILLNEED) != 0) {
+        DEBUG_LOG("madvise will need failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+// reports the residency of each page of the buffer, the lowest bit is set for the pages which are mapped
+static std::vector<uint8_t> resident_pages(const void* data, size_t size) {
+    const size_t pagesize = getpagesize();
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    std::vector<uint8_t> retVal(div_up(end - begin, pagesize), 0);
+    auto* pages = reinterpret_cast<void*>(begin);  // NOLINT(performance-no-int-to-ptr)
+    if (mincore(pages, end - begin, retVal.data()) != 0) {
+        DEBUG_LOG("mincore failed: ", strerror(errno));
+        std::fill(retVal.begin(), retVal.end(), 0);
+    }
+    return retVal;
+}
+
+size_t huge_page_resident_bytes(const void* data, size_t size) {
+    if (!data || size == 0) {
+        return 0;
+    }
+    std::ifstream smaps("/proc/self/smaps");
+    if (!smaps.is_open()) {
+        return 0;
+    }
+    const auto begin = reinterpret_cast<uintptr_t>(data);
+    const auto end = begin + size;
+    size_t retVal = 0;
+    // the statistics of a mapping are reported per the whole mapping, so take the part which overlaps with the buffer
+    double overlap_ratio = 0.0;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        uintptr_t vma_begin = 0;
+        uintptr_t vma_end = 0;
+        char dash = 0;
+        std::istringstream header(line);
+        if (header >> std::hex >> vma_begin >> dash >> vma_end && dash == '-') {
+            const auto overlap_begin = std::max(vma_begin, begin);
+            const auto overlap_end = std::min(vma_end, end);
+            overlap_ratio = overlap_end > overlap_begin ? static_cast<double>(overlap_end - overlap_begin) /
+                                                             static_cast<double>(vma_end - vma_begin)
+                                                       : 0.0;
+            continue;
+        }
+        if (overlap_ratio == 0.0) {
+            continue;
+        }
+        std::istringstream field(line);
+        std::string key;
+        size_t value_kb = 0;
+        if (field >> key >> value_kb &&
+            (key == "AnonHugePages:" || key == "Private_Hugetlb:" || key == "Shared_Hugetlb:")) {
+            retVal += static_cast<size_t>(static_cast<double>(value_kb * 1024) * overlap_ratio);
+        }
+    }
+    return std::min(retVal, size);
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool madvise_huge_pages(void* data, size_t size) {
+    return false;
+}
+
+size_t huge_page_resident_bytes(const void* data, size_t size) {
+    return 0;
+}
+
+bool madvise_will_need(const void* data, size_t size) {
+    return false;
+}
+
+bool mbind_interleave(void* data, size_t size) {
+    return false;
+}
+
+std::map<int, size_t> numa_resident_bytes(const void* data, size_t size) {
+    return {};
+}
+
+static std::vector<uint8_t> resident_pages(const void* data, size_t size) {
+    const size_t pagesize = 4096;
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    return std::vector<uint8_t>(div_up(end - begin, pagesize), 0);
+}
+#endif
+
+bool apply_numa_placement(void* data, size_t size, const NumaPlacement& placement) {
+    switch (placement.policy) {
+    case NumaPlacement::Policy::DEFAULT:
+        return true;
+    case NumaPlacement::Policy::BIND:
+        return placement.node < 0 || mbind_move(data, size, placement.node);
+    case NumaPlacement::Policy::INTERLEAVE:
+        return mbind_interleave(data, size);
+    case NumaPlacement::Policy::FIRST_TOUCH: {
+        // pages get assigned to the node of the thread which writes them first, so split the buffer across the
+        // threads of the current stream instead of letting the allocating thread touch everything. Only the pages
+        // which are not mapped yet are touched: the pages recycled by the allocator already have their node.
+#if defined(__linux__)
+        const size_t pagesize = getpagesize();
+#else
+        const size_t pagesize = 4096;
 #endif
+        const auto begin = reinterpret_cast<uintptr_t>(data) & ~(static_cast<uintptr_t>(pagesize - 1));
+        const auto resident = resident_pages(data, size);
+        parallel_nt(0, [&](const size_t ithr, const size_t nthr) {
+            size_t start = 0, stop = 0;
+            splitter(resident.size(), nthr, ithr, start, stop);
+            for (size_t i = start; i < stop; i++) {
+                if (resident[i] & 1) {
+                    continue;
+                }
+                // the page may be swapped out, so write back the value which is read
+                const auto addr = std::max(begin + i * pagesize, reinterpret_cast<uintptr_t>(data));
+                auto* ptr = reinterpret_cast<volatile uint8_t*>(addr);  // NOLINT(performance-no-int-to-ptr)
+                *ptr = *ptr;
+            }
+        });
+        return true;
+    }
+    default:
+        return false;
+    }
+}
 
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
     void* data = mem->getData();
@@ -7,6 +7,9 @@
 #include <cpu_shape.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -19,6 +22,7 @@
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "internal_properties.hpp"
 #include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -74,12 +78,37 @@ public:
     [[nodiscard]] virtual bool hasExtBuffer() const noexcept = 0;
 };
 
+/**
+ * @brief Describes how the pages of a freshly allocated memory buffer are placed across NUMA nodes.
+ */
+struct NumaPlacement {
+    enum class Policy : uint8_t {
+        DEFAULT,      //!< no explicit placement, the OS places pages on the node of the first touching thread
+        BIND,         //!< pages are bound to the given node
+        INTERLEAVE,   //!< pages are interleaved across all the available nodes
+        FIRST_TOUCH,  //!< pages are touched by the threads of the calling stream right after the allocation
+    };
+
+    NumaPlacement() = default;
+    NumaPlacement(Policy policy, int node) : policy(policy), node(node) {}
+
+    Policy policy = Policy::DEFAULT;
+    int node = -1;
+};
+
 /**
  * @brief An implementation of the mem block where memory reallocation occurs only if a bigger buffer is requested.
  */
 class MemoryBlockWithReuse : public IMemoryBlock {
 public:
-    explicit MemoryBlockWithReuse(int numa_node = -1) : m_data(nullptr, release), numa_node(numa_node) {}
+    explicit MemoryBlockWithReuse(int numa_node = -1)
+        : MemoryBlockWithReuse(numa_node >= 0 ? NumaPlacement{NumaPlacement::Policy::BIND, numa_node}
+                                              : NumaPlacement{}) {}
+    explicit MemoryBlockWithReuse(NumaPlacement placement,
+                                  ov::intel_cpu::HugePagesMode hugePages = ov::intel_cpu::HugePagesMode::DISABLED)
+        : m_data(nullptr, release),
+          m_numaPlacement(placement),
+          m_hugePages(hugePages) {}
     [[nodiscard]] void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
@@ -90,8 +119,9 @@ public:
 private:
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0UL;
-    std::unique_ptr<void, void (*)(void*)> m_data;
-    int numa_node;
+    std::unique_ptr<void, std::function<void(void*)>> m_data;
+    NumaPlacement m_numaPlacement;
+    ov::intel_cpu::HugePagesMode m_hugePages;
 
     static void release(void* ptr);
     static void destroy(void* ptr);
@@ -448,6 +478,38 @@ using StringMemoryPtr = std::shared_ptr<StringMemory>;
 bool mbind_move(void* data, size_t size, int targetNode);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
+bool mbind_interleave(void* data, size_t size);
+
+/**
+ * @brief Applies the NUMA placement to the memory buffer. FIRST_TOUCH placement touches the pages which are not mapped
+ * yet from the threads of the current parallel region, the buffer content is preserved.
+ * @return false if the placement could not be applied
+ */
+bool apply_numa_placement(void* data, size_t size, const NumaPlacement& placement);
+
+/**
+ * @brief Queries the resident location of the buffer pages.
+ * @return number of resident bytes per system NUMA node id, pages which were not touched yet are not reported
+ */
+std::map<int, size_t> numa_resident_bytes(const void* data, size_t size);
+
+/**
+ * @brief Advises the OS to back the buffer with transparent huge pages. Already resident pages are collapsed
+ * asynchronously by the kernel.
+ * @return false if the advice could not be applied
+ */
+bool madvise_huge_pages(void* data, size_t size);
+
+/**
+ * @brief Queries how many bytes of the buffer are backed by huge pages (both transparent and explicit).
+ */
+size_t huge_page_resident_bytes(const void* data, size_t size);
+
+/**
+ * @brief Advises the OS to read the buffer pages ahead. For file backed mappings the pages are read asynchronously.
+ * @return false if the advice could not be applied
+ */
+bool madvise_will_need(const void* data, size_t size);
 
 MemoryPtr split_horizontal(const dnnl::engine& eng,
                            const MemoryPtr& src,
@@ -389,22 +389,49 @@ void Graph::Init(const std::shared_ptr<const ov::Model>& model,
     Configure();
 }
 
-void Graph::Activate() {
+void Graph::Activate(bool lazyWeights) {
     // @todo It is possible that execution graph is already created in scope of
     // the allocation context collection from the outer graph so the state for inner graph is "Ready"
     // We probably want to avoid such uncertainty
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
     Allocate();
 
-    CreatePrimitivesAndExecConstants();
+    m_activatedNodes = 0;
+    if (lazyWeights) {
+        // the primitives are created and the constant nodes are executed by the first inference right before the
+        // nodes which need them, meanwhile the constants are read ahead, so the first layers do not wait for the page
+        // faults of the next ones
+        m_lazyActivation = true;
+        PrefetchConstants();
+    } else {
+        m_lazyActivation = false;
+        ActivateNodes(graphNodes.size());
+    }
+
+    CPU_DEBUG_CAP_ENABLE(serialize(*this));
+}
 
+void Graph::ActivateNodes(size_t stopIndx) {
+    if (m_activatedNodes >= stopIndx) {
+        return;
+    }
+
+    CreatePrimitivesAndExecConstants(m_activatedNodes, stopIndx);
+    m_activatedNodes = stopIndx;
+
+    if (m_activatedNodes < graphNodes.size()) {
+        return;
+    }
+
+    // the constant inputs may still be needed by the primitives of the next nodes, so the nodes are cleaned up once
+    // the whole graph is activated
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
         graphNode->cleanup();
     }
 #endif
 
-    CPU_DEBUG_CAP_ENABLE(serialize(*this));
+    m_lazyActivation = false;
 }
 
 void Graph::Configure([[maybe_unused]] bool optimize) {
@@ -531,7 +558,7 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
+void Graph::CreatePrimitivesAndExecConstants(size_t startIndx, size_t stopIndx) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
 
@@ -558,7 +585,8 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (const auto& node : graphNodes) {
+    for (size_t i = startIndx; i < stopIndx; i++) {
+        const auto& node = graphNodes[i];
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
@@ -585,6 +613,24 @@ void Graph::CreatePrimitivesAndExecConstants() const {
     }
 }
 
+void Graph::PrefetchConstants() const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::PrefetchConstants");
+    // in execution order, so the weights of the first layers are requested first
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Type::Input || !node->isConstant()) {
+            continue;
+        }
+        const auto inputNode = std::dynamic_pointer_cast<node::Input>(node);
+        const MemoryCPtr memory = inputNode ? inputNode->getMemoryPtr() : nullptr;
+        if (!memory || memory->getPrecision() == ov::element::string || memory->getSize() == 0) {
+            continue;
+        }
+        if (!madvise_will_need(memory->getData(), memory->getSize())) {
+            DEBUG_LOG("Failed to prefetch constant: ", node->getName());
+        }
+    }
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc,
                                const MemoryDescPtr& childDesc,
                                const dnnl::engine& eng) {
@@ -1218,27 +1264,37 @@ void Graph::PushInputData(const std::size_t& index, const ov::SoPtr<ITensor>& in
     OPENVINO_ASSERT(IsReady(), "Wrong state. Topology not ready.");
     if (index < inputNodes.size() && inputNodes[index]) {
         auto node = inputNodes[index];
+        auto* inputNode = dynamic_cast<node::Input*>(node.get());
         auto childEdge = node->getChildEdgeAt(0);
         const auto& edgeMemory = childEdge->getMemory();
 
         const void* ext_data_ptr = input->data();
         void* inter_data_ptr = edgeMemory.getData();
 
+        auto binding = node::Input::Binding::ZeroCopy;
         if (ext_data_ptr != inter_data_ptr) {
+            PERF(node, getConfig().collectPerfCounters);
             auto ext_tensor_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(input);
             auto actualDesc = edgeMemory.getDescPtr();
 
             if (actualDesc->getPrecision() == element::string) {
                 StringMemory ext_mem(getEngine(), ext_tensor_desc, ext_data_ptr);
                 edgeMemory.load(ext_mem, false, false);
+                binding = node::Input::Binding::Copy;
             } else if (!actualDesc->isCompatible(*ext_tensor_desc)) {
                 Memory ext_mem(getEngine(), ext_tensor_desc, ext_data_ptr, false);
                 edgeMemory.load(ext_mem, false, false);
+                binding = node::Input::Binding::Reorder;
             } else {
                 size_t size_to_copy = ext_tensor_desc->getCurrentMemSize();
                 cpu_parallel_memcpy(inter_data_ptr, ext_data_ptr, size_to_copy);
+                binding = node::Input::Binding::Copy;
             }
         }
+        if (inputNode && inputNode->getBinding() != binding) {
+            inputNode->setBinding(binding);
+            DEBUG_LOG("Input ", node->getName(), " is bound as ", inputNode->getBindingType());
+        }
     } else {
         OPENVINO_THROW("Input tensor with index '", index, "' is not available in the model");
     }
@@ -1640,6 +1696,24 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
     }
 }
 
+void Graph::InferLazy(SyncInferRequest* request, int numaId) {
+    // The nodes are activated in the execution order, each one right before it is executed. The shapes of a dynamic
+    // node are updated before its primitive is created, so createPrimitive() sees the same defined shapes as
+    // prepareParams() would, and the nodes are processed sequentially, which is always valid for the sync points.
+    for (const auto& node : m_executableGraphNodes) {
+        if (node->isDynamicNode()) {
+            node->updateShapes();
+        }
+        ActivateNodes(static_cast<size_t>(node->getExecIndex()) + 1);
+        if (node->isDynamicNode()) {
+            node->updateDynamicParams();
+        }
+        ExecuteNodeWithCatch(node, request, numaId);
+    }
+    // the trailing non executable nodes
+    ActivateNodes(graphNodes.size());
+}
+
 static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     int numaNodeId = -1;
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -1657,20 +1731,25 @@ void Graph::Infer(SyncInferRequest* request) {
 
     m_context->allocateMemory();
 
-    switch (status) {
-    case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
-        break;
-    case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
-        break;
-    case Status::ReadyStatic:
-        InferStatic(request, numaId);
-        break;
-    default:
-        OPENVINO_ASSERT(IsReady(),
-                        "Wrong state of the ov::intel_cpu::Graph. Topology is not ready: ",
-                        static_cast<int>(status));
+    if (m_lazyActivation) {
+        // the first inference of a lazily activated graph
+        InferLazy(request, numaId);
+    } else {
+        switch (status) {
+        case Status::ReadyDynamic:
+            InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+            break;
+        case Status::ReadyDynamicSeq:
+            InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+            break;
+        case Status::ReadyStatic:
+            InferStatic(request, numaId);
+            break;
+        default:
+            OPENVINO_ASSERT(IsReady(),
+                            "Wrong state of the ov::intel_cpu::Graph. Topology is not ready: ",
+                            static_cast<int>(status));
+        }
     }
 
     if (infer_count != -1) {
@@ -260,8 +260,10 @@ public:
 
     /**
      * Activate execution graph
+     * @param lazyWeights postpone primitives creation and constant nodes execution of each node
+     *        till the first inference reaches it
      */
-    void Activate();
+    void Activate(bool lazyWeights = false);
 
     /**
      * Register the graph in the global allocation context by transforming
@@ -326,7 +328,9 @@ protected:
     void ResolveComplexInplaceConflicts();
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
-    void CreatePrimitivesAndExecConstants() const;
+    void CreatePrimitivesAndExecConstants(size_t startIndx, size_t stopIndx) const;
+    void ActivateNodes(size_t stopIndx);
+    void PrefetchConstants() const;
     std::vector<size_t> CreateExecutionGraph();
 
     /**
@@ -349,6 +353,7 @@ protected:
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferLazy(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -374,6 +379,9 @@ private:
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+    // the number of leading graphNodes with created primitives and executed constants
+    size_t m_activatedNodes = 0;
+    bool m_lazyActivation = false;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
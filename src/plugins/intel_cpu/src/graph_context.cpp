@@ -12,6 +12,7 @@
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
+#include "internal_properties.hpp"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
 #include "openvino/runtime/system_conf.hpp"
@@ -22,6 +23,26 @@
 
 namespace ov::intel_cpu {
 
+namespace {
+
+NumaPlacement streamNumaPlacement(ov::intel_cpu::NumaMemoryPolicy policy,
+                                  const ov::threading::CPUStreamsExecutor::Ptr& cpuStreamExecutor) {
+    if (!cpuStreamExecutor || get_num_numa_nodes() < 2) {
+        return {};
+    }
+    const int numaNodeId = cpuStreamExecutor->get_numa_node_id();
+    switch (policy) {
+    case ov::intel_cpu::NumaMemoryPolicy::BIND:
+        return numaNodeId >= 0 ? NumaPlacement{NumaPlacement::Policy::BIND, numaNodeId} : NumaPlacement{};
+    case ov::intel_cpu::NumaMemoryPolicy::FIRST_TOUCH:
+        return {NumaPlacement::Policy::FIRST_TOUCH, numaNodeId};
+    default:
+        return {};
+    }
+}
+
+}  // namespace
+
 GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
@@ -34,14 +55,15 @@ GraphContext::GraphContext(Config config,
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
+      m_cpuStreamExecutor(std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
+      m_numaPlacement(streamNumaPlacement(m_config.numaMemoryPolicy, m_cpuStreamExecutor)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_numaPlacement, m_config.hugePages)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
-        m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
         m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
         auto nNumaNodes = get_num_numa_nodes();
         if (m_numNumaNodes < nNumaNodes) {
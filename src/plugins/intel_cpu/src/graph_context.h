@@ -85,6 +85,11 @@ public:
         return m_numNumaNodes;
     }
 
+    // NUMA placement of the memory owned by the current stream (activation arenas, KV cache)
+    [[nodiscard]] const NumaPlacement& getNumaPlacement() const {
+        return m_numaPlacement;
+    }
+
     [[nodiscard]] const std::shared_ptr<node::MemoryStatesRegister>& getMemoryStatesRegister() const {
         return m_memoryStatesRegister;
     }
@@ -130,6 +135,7 @@ private:
     std::shared_ptr<CpuParallel> m_cpuParallel = nullptr;
     // numa submemory manager
     std::shared_ptr<SubMemoryManager> m_subMemoryManager;
+    NumaPlacement m_numaPlacement;
 
     int m_numNumaNodes = 1;
     int m_numaNodeId = 0;
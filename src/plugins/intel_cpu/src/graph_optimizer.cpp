@@ -3160,7 +3160,12 @@ void GraphOptimizer::RemoveConvertMemoryOutput(Graph& graph) {
 void GraphOptimizer::MatchSdpaKvCache(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
 
-    auto isSuitableMemInput = [](const NodePtr& node) -> bool {
+    auto isKVCacheReader = [](const NodePtr& node) {
+        auto sdpa = std::dynamic_pointer_cast<ScaledDotProductAttention>(node);
+        return sdpa && sdpa->isKVCacheReader();
+    };
+
+    auto isSuitableMemInput = [&isKVCacheReader](const NodePtr& node) -> bool {
         if (Type::MemoryInput != node->getType()) {
             return false;
         }
@@ -3172,7 +3177,8 @@ void GraphOptimizer::MatchSdpaKvCache(Graph& graph) {
                 return false;
             }
 
-            if (Type::ScaledDotProductAttention == childNode->getType()) {
+            // the SDPA nodes sharing the KV cache only read it, so they are not the updating child
+            if (Type::ScaledDotProductAttention == childNode->getType() && !isKVCacheReader(childNode)) {
                 if (childSdpa && childSdpa != childNode) {
                     // only one child SDPA supported
                     return false;
@@ -3221,16 +3227,21 @@ void GraphOptimizer::MatchSdpaKvCache(Graph& graph) {
             }
         }
 
-        // search for SDPA
+        // search for SDPA and the SDPA nodes reading the same KV cache
         std::shared_ptr<ScaledDotProductAttention> sdpa;
+        std::vector<std::shared_ptr<ScaledDotProductAttention>> sdpaReaders;
         for (auto&& edge : node->getChildEdgesAtPort(0)) {
             auto child = edge->getChild();
             if (Type::ScaledDotProductAttention == child->getType()) {
-                sdpa = std::dynamic_pointer_cast<ScaledDotProductAttention>(child);
-                if (sdpa) {
-                    break;
+                auto childSdpa = std::dynamic_pointer_cast<ScaledDotProductAttention>(child);
+                if (!childSdpa) {
+                    OPENVINO_THROW("Couldn't cast node", child->getName(), " to ScaledDotProductAttention type");
+                }
+                if (childSdpa->isKVCacheReader()) {
+                    sdpaReaders.push_back(childSdpa);
+                } else {
+                    sdpa = childSdpa;
                 }
-                OPENVINO_THROW("Couldn't cast node", child->getName(), " to ScaledDotProductAttention type");
             }
         }
 
@@ -3245,7 +3256,8 @@ void GraphOptimizer::MatchSdpaKvCache(Graph& graph) {
                                                               graph.getGraphContext(),
                                                               inputShapes,
                                                               inputPrcs,
-                                                              sdpa);
+                                                              sdpa,
+                                                              sdpaReaders);
 
         if (!memInputNode->getParentEdges().empty()) {
             auto parentEdge = memInputNode->getParentEdgeAt(0);
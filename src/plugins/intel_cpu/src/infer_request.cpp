@@ -310,6 +310,12 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
                           " infer request ",
                           this);
                 DEBUG_LOG(index, ", tensor ", controlBlock.tensor());
+            } else if (auto userBlockItr = m_outputUserBlocks.find(index);
+                       userBlockItr != m_outputUserBlocks.end() &&
+                       !inputPtrs.count(userBlockItr->second->tensorPtr())) {
+                // write the output directly into the user tensor, which grows on demand
+                outputMemBlock->setMemBlockResize(userBlockItr->second);
+                DEBUG_LOG("reset proxy ", outputMemBlock, " to user tensor of output ", index, " infer request ", this);
             } else {
                 outputMemBlock->reset();  // switch to the internal memory since memory sharing is no longer possible
             }
@@ -464,6 +470,14 @@ void SyncInferRequest::set_tensor(const ov::Output<const ov::Node>& in_port, con
             m_output_external_ptr.erase(output_index);
         }
 
+        const auto elementType = tensor->get_element_type();
+        if (isDynamic && elementType == desc.getPrecision() && elementType != element::string &&
+            elementType.bitwidth() >= 8) {
+            m_outputUserBlocks[output_index] = std::make_shared<UserOutputMemoryBlock>(tensor);
+        } else {
+            m_outputUserBlocks.erase(output_index);
+        }
+
         m_outputs[output_index] = tensor;
         m_outputControlBlocks.erase(output_index);  // now the memory is under user's control
     }
@@ -627,6 +641,39 @@ SyncInferRequest::OutputControlBlock::OutputControlBlock(const ov::element::Type
     m_tensor = std::make_shared<Tensor>(memory);
 }
 
+void* SyncInferRequest::UserOutputMemoryBlock::getRawPtr() const noexcept {
+    return m_useFallback ? m_fallback->getRawPtr() : m_tensor->data();
+}
+
+void SyncInferRequest::UserOutputMemoryBlock::setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) {
+    OPENVINO_THROW("User output memory block doesn't support external buffers");
+}
+
+bool SyncInferRequest::UserOutputMemoryBlock::resize(size_t size) {
+    const void* prevPtr = getRawPtr();
+    m_useFallback = false;
+    if (size > m_tensor->get_byte_size()) {
+        // flat shape of the required capacity, the final shape is set when the output is pulled
+        const auto elementSize = m_tensor->get_element_type().size();
+        try {
+            m_tensor->set_shape(ov::Shape{div_up(size, elementSize)});
+        } catch (const ov::Exception&) {
+            m_useFallback = true;
+        }
+    }
+    if (m_useFallback) {
+        if (!m_fallback) {
+            m_fallback = std::make_shared<MemoryBlockWithReuse>();
+        }
+        m_fallback->resize(size);
+    }
+    return getRawPtr() != prevPtr;
+}
+
+bool SyncInferRequest::UserOutputMemoryBlock::hasExtBuffer() const noexcept {
+    return true;
+}
+
 void SyncInferRequest::sub_streams_infer() {
     std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> input_tensors;
     auto message = ov::threading::message_manager();
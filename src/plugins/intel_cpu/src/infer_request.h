@@ -107,6 +107,30 @@ private:
         int m_buffIndx = 0;
     };
 
+    /**
+     * @brief Lets the graph write a dynamic output directly into a user tensor. The tensor is grown via set_shape,
+     * so a tensor owning its memory through an ov::Allocator is reallocated by the user allocator. If the tensor
+     * cannot grow (e.g. it wraps a fixed user pointer), an internal buffer is used and the data is copied out.
+     */
+    class UserOutputMemoryBlock : public IMemoryBlock {
+    public:
+        explicit UserOutputMemoryBlock(ov::SoPtr<ov::ITensor> tensor) : m_tensor(std::move(tensor)) {}
+
+        [[nodiscard]] void* getRawPtr() const noexcept override;
+        void setExtBuff(void* ptr, size_t size) override;
+        bool resize(size_t size) override;
+        [[nodiscard]] bool hasExtBuffer() const noexcept override;
+
+        [[nodiscard]] const void* tensorPtr() const {
+            return m_tensor->data();
+        }
+
+    private:
+        ov::SoPtr<ov::ITensor> m_tensor;
+        std::shared_ptr<MemoryBlockWithReuse> m_fallback = nullptr;
+        bool m_useFallback = false;
+    };
+
     void create_infer_request();
     void init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type);
 
@@ -120,6 +144,7 @@ private:
     void sub_streams_infer();
 
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
+    std::unordered_map<std::size_t, std::shared_ptr<UserOutputMemoryBlock>> m_outputUserBlocks;
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
@@ -80,4 +80,132 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Defines the number of local KV cache blocks each query block attends to in the static block-sparse
+ * attention pattern of PagedAttention. 0 disables the pattern. The pattern is not applied to models with a sliding
+ * window or when XAttention estimates the block mask.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> sparse_attn_local_blocks{"CPU_SPARSE_ATTN_LOCAL_BLOCKS"};
+
+/**
+ * @brief Defines the number of leading tokens (attention sinks) that stay attended in the block-sparse attention
+ * pattern. They are rounded up to whole KV cache blocks.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> sparse_attn_sink_tokens{"CPU_SPARSE_ATTN_SINK_TOKENS"};
+
+/**
+ * @brief Defines the stride of the dilated global KV cache blocks in the block-sparse attention pattern: every
+ * N-th block is attended by all queries. 0 disables the global blocks.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> sparse_attn_global_stride{"CPU_SPARSE_ATTN_GLOBAL_STRIDE"};
+
+/**
+ * @brief Enum to define NUMA placement of the per-stream memory (activation arenas and KV cache).
+ */
+enum class NumaMemoryPolicy : uint8_t {
+    DEFAULT = 0,      //!<  Rely on the OS default placement
+    BIND = 1,         //!<  Bind pages to the NUMA node of the owning stream
+    FIRST_TOUCH = 2,  //!<  Initialize pages from the threads of the owning stream
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const NumaMemoryPolicy& policy) {
+    switch (policy) {
+    case NumaMemoryPolicy::DEFAULT:
+        return os << "DEFAULT";
+    case NumaMemoryPolicy::BIND:
+        return os << "BIND";
+    case NumaMemoryPolicy::FIRST_TOUCH:
+        return os << "FIRST_TOUCH";
+    default:
+        OPENVINO_THROW("Unsupported NUMA memory policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, NumaMemoryPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEFAULT") {
+        policy = NumaMemoryPolicy::DEFAULT;
+    } else if (str == "BIND") {
+        policy = NumaMemoryPolicy::BIND;
+    } else if (str == "FIRST_TOUCH") {
+        policy = NumaMemoryPolicy::FIRST_TOUCH;
+    } else {
+        OPENVINO_THROW("Unsupported NUMA memory policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define NUMA placement of the per-stream memory.
+ * @param DEFAULT - memory is placed by the OS
+ * @param BIND - memory is bound to the NUMA node of the stream which owns it
+ * @param FIRST_TOUCH - memory is initialized by the threads of the stream which owns it
+ */
+static constexpr Property<NumaMemoryPolicy, PropertyMutability::RW> numa_memory_policy{"CPU_NUMA_MEMORY_POLICY"};
+
+/**
+ * @brief Define whether the weights cache entries are interleaved across all NUMA nodes
+ * @param true - interleave
+ * @param false - use the default placement
+ */
+static constexpr Property<bool, PropertyMutability::RW> numa_interleave_weights{"CPU_NUMA_INTERLEAVE_WEIGHTS"};
+
+/**
+ * @brief Enum to define huge pages usage for the large plugin allocations.
+ */
+enum class HugePagesMode : uint8_t {
+    DISABLED = 0,     //!<  Regular pages only
+    TRANSPARENT = 1,  //!<  Advise transparent huge pages for the allocations
+    EXPLICIT = 2,     //!<  Map explicit (hugetlbfs) huge pages, fall back to transparent huge pages
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const HugePagesMode& mode) {
+    switch (mode) {
+    case HugePagesMode::DISABLED:
+        return os << "DISABLED";
+    case HugePagesMode::TRANSPARENT:
+        return os << "TRANSPARENT";
+    case HugePagesMode::EXPLICIT:
+        return os << "EXPLICIT";
+    default:
+        OPENVINO_THROW("Unsupported huge pages mode value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, HugePagesMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "DISABLED") {
+        mode = HugePagesMode::DISABLED;
+    } else if (str == "TRANSPARENT") {
+        mode = HugePagesMode::TRANSPARENT;
+    } else if (str == "EXPLICIT") {
+        mode = HugePagesMode::EXPLICIT;
+    } else {
+        OPENVINO_THROW("Unsupported huge pages mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define whether activation arenas, KV cache and repacked weights are backed by huge pages.
+ * Allocations fall back to regular pages when huge pages are not available.
+ * @param DISABLED - regular pages only
+ * @param TRANSPARENT - madvise transparent huge pages
+ * @param EXPLICIT - explicit 2 MB huge pages (1 GB ones for sizes close to a 1 GB multiple) with fallback to
+ *                   transparent huge pages
+ */
+static constexpr Property<HugePagesMode, PropertyMutability::RW> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief Defines whether primitives creation and weights repacking are postponed from compile_model till the first
+ * inference of each stream. The constants are read ahead in the background meanwhile.
+ */
+static constexpr Property<bool, PropertyMutability::RW> lazy_weights{"CPU_LAZY_WEIGHTS"};
+
 }  // namespace ov::intel_cpu
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <queue>
@@ -63,8 +64,9 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
-        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
+    explicit MemoryBlockWithRelease(NumaPlacement numaPlacement = {},
+                                    ov::intel_cpu::HugePagesMode hugePages = ov::intel_cpu::HugePagesMode::DISABLED) {
+        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>(numaPlacement, hugePages);
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
     }
@@ -201,6 +203,10 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    MemoryManagerStatic(NumaPlacement numaPlacement, ov::intel_cpu::HugePagesMode hugePages)
+        : m_numaPlacement(numaPlacement),
+          m_hugePages(hugePages) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -223,10 +229,21 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        // the best-fit solver is not guaranteed to beat the greedy one, so both are run and the smaller arena wins
+        ov::MemorySolver greedyMemSolver(boxes_to_process);
+        const int64_t greedySize = greedyMemSolver.solve();
+
+        // local search is quadratic in the number of boxes per iteration, limit it to the small graphs
+        constexpr size_t refinementMaxBoxes = 512;
+        constexpr size_t refinementIterations = 64;
+        ov::MemorySolver bestFitMemSolver(boxes_to_process);
+        const int64_t bestFitSize = bestFitMemSolver.solve_best_fit(
+            boxes_to_process.size() <= refinementMaxBoxes ? refinementIterations : 0);
+
+        const auto& staticMemSolver = bestFitSize < greedySize ? bestFitMemSolver : greedyMemSolver;
+        m_totalSize = static_cast<size_t>(std::min(bestFitSize, greedySize)) * alignment;
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        m_workspace = std::make_shared<MemoryBlockWithRelease>(m_numaPlacement, m_hugePages);
 
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
@@ -253,6 +270,8 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    NumaPlacement m_numaPlacement;
+    ov::intel_cpu::HugePagesMode m_hugePages;
     size_t m_totalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
@@ -260,6 +279,10 @@ private:
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    MemoryManagerNonOverlappingSets(NumaPlacement numaPlacement, ov::intel_cpu::HugePagesMode hugePages)
+        : m_numaPlacement(numaPlacement),
+          m_hugePages(hugePages) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -325,7 +348,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_numaPlacement, m_hugePages);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -348,6 +371,8 @@ private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    NumaPlacement m_numaPlacement;
+    ov::intel_cpu::HugePagesMode m_hugePages;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -380,6 +405,12 @@ std::pair<int64_t, int64_t> calculateOptimalMemorySize(std::vector<MemorySolver:
     return {max_current_size, max_box_size};
 }
 
+void accumulateNumaNodeBytes(std::map<int, size_t>& numa_node_bytes, const void* data, size_t size) {
+    for (auto&& [node, bytes] : numa_resident_bytes(data, size)) {
+        numa_node_bytes[node] += bytes;
+    }
+}
+
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj) {
     auto total_size = std::accumulate(obj.m_blocks.begin(),
                                       obj.m_blocks.end(),
@@ -393,12 +424,20 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj) {
                                            [](size_t acc, const MemoryManagerIO::BlockType& item) {
                                                return std::max(acc, item.size());
                                            });
+    std::map<int, size_t> numa_node_bytes;
+    size_t huge_page_bytes = 0;
+    for (const MemoryManagerIO::BlockType& item : obj.m_blocks) {
+        accumulateNumaNodeBytes(numa_node_bytes, item.getRawPtr(), item.size());
+        huge_page_bytes += huge_page_resident_bytes(item.getRawPtr(), item.size());
+    }
     return {MemoryManagerIO::getClassName(),
             obj.m_blocks.size(),  // as the number of blocks ie equal to regions
             obj.m_blocks.size(),
             total_size,
             total_size,
-            max_region_size};
+            max_region_size,
+            std::move(numa_node_bytes),
+            huge_page_bytes};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
@@ -406,12 +445,20 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
         return calculateOptimalMemorySize(obj.m_boxes);
     }();
 
+    std::map<int, size_t> numa_node_bytes;
+    size_t huge_page_bytes = 0;
+    if (obj.m_workspace) {
+        accumulateNumaNodeBytes(numa_node_bytes, obj.m_workspace->getRawPtr(), obj.m_workspace->size());
+        huge_page_bytes = huge_page_resident_bytes(obj.m_workspace->getRawPtr(), obj.m_workspace->size());
+    }
     return {MemoryManagerStatic::getClassName(),
             obj.m_boxes.size(),
             1,  // in fact there is only one unique block
             obj.m_totalSize,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            std::move(numa_node_bytes),
+            huge_page_bytes};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj) {
@@ -439,12 +486,20 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
         return calculateOptimalMemorySize(std::move(tmp_boxes));
     }();
 
+    std::map<int, size_t> numa_node_bytes;
+    size_t huge_page_bytes = 0;
+    for (auto&& item : uniqueBlocks) {
+        accumulateNumaNodeBytes(numa_node_bytes, item->getRawPtr(), item->size());
+        huge_page_bytes += huge_page_resident_bytes(item->getRawPtr(), item->size());
+    }
     return {MemoryManagerNonOverlappingSets::getClassName(),
             obj.m_boxes.size(),
             uniqueBlocks.size(),
             total_size,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            std::move(numa_node_bytes),
+            huge_page_bytes};
 }
 #endif
 
@@ -517,18 +572,25 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, NumaPlacement numaPlacement, ov::intel_cpu::HugePagesMode hugePages)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        numaPlacement,
+        hugePages));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        numaPlacement,
+        hugePages));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -590,7 +652,8 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_numaPlacement, m_hugePages)));
     return m_controlUnits.back();
 }
 
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -33,11 +34,13 @@ struct MemoryRegion {
 using MemoryRegions = std::vector<MemoryRegion>;
 struct MemoryStatisticsRecord {
     const char* id;
-    size_t total_regions;        // number of regions
-    size_t total_unique_blocks;  // bytes
-    size_t total_size;           // bytes
-    size_t optimal_total_size;   // bytes
-    size_t max_region_size;      // bytes
+    size_t total_regions;                   // number of regions
+    size_t total_unique_blocks;             // bytes
+    size_t total_size;                      // bytes
+    size_t optimal_total_size;              // bytes
+    size_t max_region_size;                 // bytes
+    std::map<int, size_t> numa_node_bytes;  // resident bytes per NUMA node
+    size_t huge_page_bytes;                 // bytes backed by huge pages
 };
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
@@ -67,7 +70,7 @@ public:
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, NumaPlacement numaPlacement, ov::intel_cpu::HugePagesMode hugePages);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -81,6 +84,9 @@ private:
 class NetworkMemoryControl {
 public:
     NetworkMemoryControl() = default;
+    NetworkMemoryControl(NumaPlacement numaPlacement, ov::intel_cpu::HugePagesMode hugePages)
+        : m_numaPlacement(numaPlacement),
+          m_hugePages(hugePages) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -94,6 +100,8 @@ public:
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    NumaPlacement m_numaPlacement;
+    ov::intel_cpu::HugePagesMode m_hugePages = ov::intel_cpu::HugePagesMode::DISABLED;
 };
 
 }  // namespace ov::intel_cpu
@@ -57,6 +57,7 @@
 #include "utils/general_utils.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/rt_info/memory_formats_attribute.hpp"
+#include "weights_cache.hpp"
 
 using namespace dnnl;
 using namespace openvino;
@@ -1202,12 +1203,15 @@ void Node::toNumaNodeImpl(int numaNodeID) {
         primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
     }
 
-    // mbind constant prim args to numa nodes
-    if (auto it = primArgs.find(DNNL_ARG_WEIGHTS); it != primArgs.end()) {
-        mbind_move(it->second, numaNodeID);
-    }
-    if (auto it = primArgs.find(DNNL_ARG_BIAS); it != primArgs.end()) {
-        mbind_move(it->second, numaNodeID);
+    // mbind constant prim args to numa nodes, unless the weights cache spreads them across all the nodes
+    const auto& weightsCache = context->getWeightsCache();
+    if (!weightsCache || !weightsCache->isInterleaved()) {
+        if (auto it = primArgs.find(DNNL_ARG_WEIGHTS); it != primArgs.end()) {
+            mbind_move(it->second, numaNodeID);
+        }
+        if (auto it = primArgs.find(DNNL_ARG_BIAS); it != primArgs.end()) {
+            mbind_move(it->second, numaNodeID);
+        }
     }
 
     curNumaNode = numaNodeID;
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ov::intel_cpu::philox {
+
+// Following const values are taken from the original paper:
+// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
+constexpr uint32_t CRUSH_RESISTANCE_CONST_LOWER_VALUE = 0x9E3779B9;
+constexpr uint32_t CRUSH_RESISTANCE_CONST_UPPER_VALUE = 0xBB67AE85;
+constexpr uint64_t STATISTIC_MAXIMIZING_MULTIPLIER_N = 0xD2511F53;
+constexpr uint64_t STATISTIC_MAXIMIZING_MULTIPLIER_COUNTER = 0xCD9E8D57;
+
+// Philox algorithm returns 4 elements of RNG sequence per each invocation
+constexpr uint64_t GROUP_SIZE = 4LU;
+
+inline void calculateRound(const uint32_t* key, uint32_t* counter, uint32_t* n) {
+    uint64_t prod_0 = STATISTIC_MAXIMIZING_MULTIPLIER_N * n[0];
+    uint64_t prod_1 = STATISTIC_MAXIMIZING_MULTIPLIER_COUNTER * counter[0];
+    n[0] = static_cast<uint32_t>(prod_1 >> 32) ^ n[1] ^ key[0];
+    n[1] = static_cast<uint32_t>(prod_1);
+    counter[0] = static_cast<uint32_t>(prod_0 >> 32) ^ counter[1] ^ key[1];
+    counter[1] = static_cast<uint32_t>(prod_0);
+}
+
+inline void raiseKey(uint32_t* key) {
+    key[0] += CRUSH_RESISTANCE_CONST_LOWER_VALUE;
+    key[1] += CRUSH_RESISTANCE_CONST_UPPER_VALUE;
+}
+
+/**
+ * @brief Counter-based Philox4x32-10 generator: the n-th group of the sequence (key, counter) is computed
+ * independently of the others, so any part of the sequence can be generated by any thread.
+ */
+inline void runPhilox(uint64_t key, uint64_t counter, uint64_t n, uint32_t* res) {
+    auto* key_32 = reinterpret_cast<uint32_t*>(&key);
+    auto* counter_32 = reinterpret_cast<uint32_t*>(&counter);
+    auto* n_32 = reinterpret_cast<uint32_t*>(&n);
+
+    // Loop unwarping for better performance
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+    raiseKey(key_32);
+    calculateRound(key_32, counter_32, n_32);
+
+    res[0] = n_32[0];
+    res[1] = n_32[1];
+    res[2] = counter_32[0];
+    res[3] = counter_32[1];
+}
+
+}  // namespace ov::intel_cpu::philox
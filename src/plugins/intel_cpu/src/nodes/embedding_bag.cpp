@@ -4,19 +4,27 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/core/type/float16.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <immintrin.h>
+#endif
 
 namespace ov::intel_cpu::node {
 
@@ -50,9 +58,28 @@ void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+namespace {
+
+// brings the row of the next index to the cache while the current one is reduced, the indices are random so the
+// hardware prefetcher can not predict them
 template <typename T>
+inline void prefetchRow([[maybe_unused]] const T* row, [[maybe_unused]] size_t rowSize) {
+#if defined(OPENVINO_ARCH_X86_64)
+    constexpr size_t cacheLineSize = 64LU;
+    constexpr size_t maxPrefetchSize = 16LU * cacheLineSize;
+    const auto* ptr = reinterpret_cast<const char*>(row);
+    const auto size = std::min(rowSize * sizeof(T), maxPrefetchSize);
+    for (size_t offset = 0LU; offset < size; offset += cacheLineSize) {
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+    }
+#endif
+}
+
+}  // namespace
+
+template <typename T, typename D>
 void EmbeddingBag::processData(const T* srcData,
-                               const T* weightsData,
+                               const D* weightsData,
                                const VectorDims& inDataDims,
                                const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
@@ -60,12 +87,29 @@ void EmbeddingBag::processData(const T* srcData,
     initFromInputs();
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
-    auto* dstData = outMemory->getDataAs<T>();
+    auto* dstData = outMemory->getDataAs<D>();
+
+    // The bags are split between the threads by the number of the rows to reduce instead of the number of the bags,
+    // so a few large bags don't stall a single thread. bagsWork[i] is the amount of work before the bag i.
+    std::vector<size_t> bagsWork(outputBagsNum + 1LU, 0LU);
+    {
+        size_t indicesSize = 0LU;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        for (size_t obi = 0LU; obi < outputBagsNum; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            bagsWork[obi + 1LU] = bagsWork[obi] + (indices != nullptr ? indicesSize : 0LU) + 1LU;
+        }
+    }
 
     auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0LU);
-        size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        const size_t totalWork = bagsWork.back();
+        auto firstBagAfter = [&](size_t work) {
+            return static_cast<size_t>(std::lower_bound(bagsWork.begin(), bagsWork.end(), work) - bagsWork.begin());
+        };
+        const size_t start = firstBagAfter(totalWork * ithr / nthr);
+        const size_t end = firstBagAfter(totalWork * (ithr + 1) / nthr);
         if (start >= end) {
             return;
         }
@@ -82,35 +126,38 @@ void EmbeddingBag::processData(const T* srcData,
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0LU;
-                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                size_t srcIndex = indices[inIdx] * _embDepth;
+                auto getSrcRow = [&](size_t inIdx) {
+                    OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
+                                    msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                    if (inIdx + 1LU < indicesSize && static_cast<size_t>(indices[inIdx + 1LU]) < inDataDims[0]) {
+                        prefetchRow(srcData + indices[inIdx + 1LU] * _embDepth, _embDepth);
+                    }
+                    return srcData + indices[inIdx] * _embDepth;
+                };
 
+                const T* srcRow = getSrcRow(0LU);
                 if (withWeights) {
                     for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                        dstData[dstIndex + i] = static_cast<D>(srcRow[i]) * weightsData[weightsIdx];
                     }
                     weightsIdx++;
                 } else {
                     for (size_t i = 0LU; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+                        dstData[dstIndex + i] = static_cast<D>(srcRow[i]);
                     }
                 }
 
-                for (inIdx = 1LU; inIdx < indicesSize; inIdx++) {
-                    OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                    msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                    size_t srcIndex = indices[inIdx] * _embDepth;
+                for (size_t inIdx = 1LU; inIdx < indicesSize; inIdx++) {
+                    srcRow = getSrcRow(inIdx);
 
                     if (withWeights) {
                         for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
+                            dstData[dstIndex + i] += static_cast<D>(srcRow[i]) * weightsData[weightsIdx];
                         }
                         weightsIdx++;
                     } else {
                         for (size_t i = 0LU; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
+                            dstData[dstIndex + i] += static_cast<D>(srcRow[i]);
                         }
                     }
                 }
@@ -143,6 +190,23 @@ void EmbeddingBag::execute(const uint8_t* srcData,
                                                                        outMemory);
         break;
     }
+    // half precision tables are reduced in f32, the per-sample weights and the output are f32
+    case ov::element::bf16: {
+        processData<element_type_traits<ov::element::bf16>::value_type, float>(
+            reinterpret_cast<const ov::bfloat16*>(srcData),
+            reinterpret_cast<const float*>(weightsData),
+            inDims,
+            outMemory);
+        break;
+    }
+    case ov::element::f16: {
+        processData<element_type_traits<ov::element::f16>::value_type, float>(
+            reinterpret_cast<const ov::float16*>(srcData),
+            reinterpret_cast<const float*>(weightsData),
+            inDims,
+            outMemory);
+        break;
+    }
     case ov::element::i8: {
         processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                                                                       reinterpret_cast<const int8_t*>(weightsData),
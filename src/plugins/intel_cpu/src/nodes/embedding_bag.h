@@ -43,8 +43,8 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
-    template <typename T>
-    void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    template <typename T, typename D = T>
+    void processData(const T* srcData, const D* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
@@ -83,7 +83,9 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // half precision tables are read as is, the reduction, the per-sample weights and the output are f32
+    const auto tablePrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    auto inDataPrecision = tablePrecision;
     if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
         inDataPrecision = ov::element::f32;
     }
@@ -102,7 +104,7 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
     }
 
     std::vector<PortConfigurator> inDataConfigurators(
-        {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
+        {{LayoutType::ncsp, tablePrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
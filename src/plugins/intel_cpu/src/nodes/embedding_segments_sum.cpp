@@ -70,7 +70,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    // half precision tables are read as is, the reduction, the per-sample weights and the output are f32
+    const auto tablePrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    auto inDataPrecision = tablePrecision;
     if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
         inDataPrecision = ov::element::f32;
     }
@@ -88,7 +90,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
                         inDataPrecision.get_type_name());
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
@@ -116,6 +118,21 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = getSrcDataAtPortAs<const int>(DEFAULT_INDEX_IDX);
     }
+
+    // the first index and the number of the indices of each segment are collected in one pass, so the lookup of
+    // a segment does not scan all the segment ids
+    segmentsBegin_.assign(lastNumSegments_, 0);
+    segmentsSize_.assign(lastNumSegments_, 0LU);
+    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
+        const auto segmentId = static_cast<size_t>(segmentIds_[si]);
+        if (segmentId >= segmentsSize_.size()) {
+            continue;
+        }
+        if (segmentsSize_[segmentId] == 0LU) {
+            segmentsBegin_[segmentId] = si;
+        }
+        segmentsSize_[segmentId]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex,
@@ -129,14 +146,10 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    size = segmentsSize_[embIndex];
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
@@ -9,6 +9,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "embedding_bag.h"
 #include "graph_context.h"
@@ -50,6 +51,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    std::vector<int> segmentsBegin_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -6,6 +6,7 @@
 
 #include <oneapi/dnnl/dnnl_types.h>
 
+#include <algorithm>
 #include <cassert>
 #include <common/primitive_attr.hpp>
 #include <common/primitive_hashing_utils.hpp>
@@ -13,6 +14,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
@@ -158,21 +160,22 @@ bool DnnlFCPrimitive::useWeightsDecompressionImpl(const ov::element::Type inputT
     return false;
 }
 
-static bool useDynamicQuantizationImpl(size_t dqGroupSize,
-                                       const MemoryDescPtr& srcDesc,
-                                       const MemoryDescPtr& weightsDesc,
-                                       const MemoryArgs& memory) {
+// Returns the group size of the dynamic quantization of the activations, 0 if it is not applicable
+static size_t getDynamicQuantizationGroupSize(uint64_t dqGroupSize,
+                                              const MemoryDescPtr& srcDesc,
+                                              const MemoryDescPtr& weightsDesc,
+                                              const MemoryArgs& memory) {
     if (dqGroupSize == 0) {
-        return false;
+        return 0;
     }
 
     if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2_vnni) &&
         !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni)) {
-        return false;
+        return 0;
     }
 
     if (srcDesc->getPrecision() != ov::element::f32) {
-        return false;
+        return 0;
     }
 
     MemoryCPtr zpPtr =
@@ -182,53 +185,55 @@ static bool useDynamicQuantizationImpl(size_t dqGroupSize,
     // w/o zero-point, we will transform weight to u8/u4 weight with zp 128/8.
     if (none_of(weightsDesc->getPrecision(), ov::element::u8, ov::element::u4, ov::element::u2) &&
         !((any_of(weightsDesc->getPrecision(), ov::element::i8, ov::element::i4) && !zpPtr))) {
-        return false;
+        return 0;
     }
     if (zpPtr && none_of(zpPtr->getDesc().getPrecision(),
                          ov::element::u8,
                          ov::element::u4,
                          ov::element::u2,
                          ov::element::dynamic)) {
-        return false;
+        return 0;
     }
 
     const size_t simdWidth = 16;
-    if (dqGroupSize % simdWidth) {
-        return false;
-    }
-
-    MemoryCPtr scalesPtr = memory.count(ARG_WEI | ARG_ATTR_SCALES) ? memory.at(ARG_WEI | ARG_ATTR_SCALES) : nullptr;
-    int ic = weightsDesc->getShape().getStaticDims()[1];
+    const auto ic = weightsDesc->getShape().getStaticDims()[1];
 
-    if (ic < static_cast<int>(simdWidth)) {
-        return false;
+    if (ic < simdWidth) {
+        return 0;
     }
 
-    if (scalesPtr && scalesPtr->getShape().getRank() != 1) {
-        auto scalesDims = scalesPtr->getShape().getStaticDims();
-        auto groupsNum = scalesDims[1];
-        size_t groupSize = ic / groupsNum;
-        if (groupsNum != 1 && groupSize % dqGroupSize) {
-            return false;
-        }
+    // UINT64_MAX requests per-token quantization, i.e. a single group along IC
+    auto groupSize = static_cast<size_t>(std::min<uint64_t>(dqGroupSize, ic));
+    if (ic % groupSize) {
+        return 0;
     }
 
-    if (zpPtr && zpPtr->getShape().getRank() != 1) {
-        auto zpDims = zpPtr->getShape().getStaticDims();
-        int groupsNum = zpDims[1];
-        size_t groupSize = ic / groupsNum;
-        if (groupsNum != 1 && groupSize % dqGroupSize) {
-            return false;
+    // the groups of the activations have to be nested in the groups of the weights scales and zero-points,
+    // so a coarser request is refined to a common divisor instead of falling back to the non quantized path
+    auto refineByWeightsGroups = [&](const MemoryCPtr& ptr) {
+        if (!ptr || ptr->getShape().getRank() == 1) {
+            return;
         }
+        const auto groupsNum = ptr->getShape().getStaticDims()[1];
+        if (groupsNum != 1) {
+            groupSize = std::gcd(groupSize, ic / groupsNum);
+        }
+    };
+    refineByWeightsGroups(memory.count(ARG_WEI | ARG_ATTR_SCALES) ? memory.at(ARG_WEI | ARG_ATTR_SCALES) : nullptr);
+    refineByWeightsGroups(zpPtr);
+
+    if (groupSize % simdWidth) {
+        return 0;
     }
 
-    return true;
+    return groupSize;
 }
 
 static DnnlPrimitiveAttrs createPrimitiveAttrs(const FCAttrs& attrs,
                                                const MemoryArgs& memory,
                                                const ExecutorContext::CPtr& context,
-                                               bool useDynamicQuantization) {
+                                               size_t dynamicQuantizationGroupSize) {
+    const bool useDynamicQuantization = dynamicQuantizationGroupSize != 0;
     const auto& srcDesc = memory.at(ARG_SRC)->getDescPtr();
     const auto& weiDesc = memory.at(ARG_WEI)->getDescPtr();
     const auto& dstDesc = memory.at(ARG_DST)->getDescPtr();
@@ -282,7 +287,7 @@ static DnnlPrimitiveAttrs createPrimitiveAttrs(const FCAttrs& attrs,
                                                         !attrs.weightsNonTransposed,
                                                         ov::element::u8);
         }
-        dnnlpoc.setDynamicQuantizationParams(attrs.dynamicQuantizationGroupSize);
+        dnnlpoc.setDynamicQuantizationParams(dynamicQuantizationGroupSize);
     }
 
     return dnnlpoc.compose();
@@ -418,11 +423,13 @@ DnnlShapeAgnosticDataPtr DnnlFCPrimitive::createShapeAgnosticData(const FCAttrs&
 
     const auto useWeightsDecompression =
         useWeightsDecompressionImpl(srcDesc->getPrecision(), weiDesc->getPrecision(), attrs.modelType);
-    const auto useDynamicQuantization =
-        useWeightsDecompression &&
-        useDynamicQuantizationImpl(attrs.dynamicQuantizationGroupSize, srcDesc, weiDesc, memory);
+    const auto dynamicQuantizationGroupSize =
+        useWeightsDecompression
+            ? getDynamicQuantizationGroupSize(attrs.dynamicQuantizationGroupSize, srcDesc, weiDesc, memory)
+            : 0;
+    const auto useDynamicQuantization = dynamicQuantizationGroupSize != 0;
 
-    const auto postOpData = createPrimitiveAttrs(attrs, memory, context, useDynamicQuantization);
+    const auto postOpData = createPrimitiveAttrs(attrs, memory, context, dynamicQuantizationGroupSize);
 
     if (!cacheWeights) {
         return std::make_shared<DnnlShapeAgnosticData>(postOpData);
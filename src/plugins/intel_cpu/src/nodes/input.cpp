@@ -668,6 +668,19 @@ MemoryCPtr Input::getMemoryPtr() const {
     return memoryPtr;
 }
 
+std::string Input::getBindingType() const {
+    switch (m_binding) {
+    case Binding::ZeroCopy:
+        return "zero_copy";
+    case Binding::Copy:
+        return "memcpy";
+    case Binding::Reorder:
+        return "reorder";
+    default:
+        return getPrimitiveDescriptorType();
+    }
+}
+
 void Input::getSupportedDescriptors() {
     if (getType() == Type::Input) {
         CPU_NODE_ASSERT(getParentEdges().empty(), "has incorrect number of input edges.");
@@ -6,6 +6,7 @@
 
 #include <node.h>
 
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <openvino/op/constant.hpp>
@@ -43,6 +44,14 @@ public:
         bool inPlace = false;
     };
 
+    // How the user tensor of a model input was bound to the graph memory during the last inference
+    enum class Binding : uint8_t {
+        Undefined,
+        ZeroCopy,  // the graph reads the user memory directly
+        Copy,      // compatible descriptors, the data is copied into the graph memory
+        Reorder,   // incompatible descriptors, the data is reordered into the graph memory
+    };
+
     Input(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
 
     Input(const Shape& shape,
@@ -73,6 +82,14 @@ public:
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
 
+    void setBinding(Binding binding) {
+        m_binding = binding;
+    }
+    Binding getBinding() const {
+        return m_binding;
+    }
+    std::string getBindingType() const;
+
     void execute(const dnnl::stream& strm) override {}
     void executeDynamicImpl(const dnnl::stream& strm) override {}
 
@@ -101,6 +118,7 @@ private:
     MemoryDescPtr extMemDesc = nullptr;
     bool m_useParentMemoryDescForOutput = false;
     bool m_isInPlace = false;
+    Binding m_binding = Binding::Undefined;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -459,6 +459,9 @@ struct MHAHelper {
     // Block size used when generating sparse_attention_mask (0 means unspecified/equal to _block_size)
     size_t _sparse_mask_block_size = 0;
     bool _use_softmax_sparse_mask = false;
+    // [B_seq, kv_len_in_blocks], rows of the block-sparse pattern for the second token
+    PlainTensor _sparse_decode_mask;
+    bool _sparse_pattern_active = false;
 
     CpuParallelPtr _cpu_parallel;
 
@@ -656,6 +659,66 @@ struct MHAHelper {
         }
     }
 
+    [[nodiscard]] bool is_sparse_pattern_enabled() const {
+        return _params.sparse_local_blocks > 0 && _sliding_window == 0;
+    }
+
+    // Static block-sparse pattern: the query at position q_pos attends to the attention sink blocks, the
+    // local blocks ending at its own block and every sparse_global_stride-th block, the other KV blocks are skipped.
+    [[nodiscard]] bool is_kv_block_attended(size_t k_blk, size_t q_pos) const {
+        const auto q_pos_blk = q_pos / _block_size;
+        return k_blk * _block_size < _params.sparse_sink_tokens || k_blk + _params.sparse_local_blocks > q_pos_blk ||
+               (_params.sparse_global_stride != 0 && k_blk % _params.sparse_global_stride == 0);
+    }
+
+    // Fills the block mask of each first token sequence and the mask row of each second token sequence with the
+    // static block-sparse pattern. A query block uses the pattern of its first query, so all its rows share one row.
+    void init_sparse_pattern(const PlainTensor& past_lens,
+                             const PlainTensor& subsequence_begins,
+                             std::vector<PlainTensor>& sparse_attention_mask) {
+        const auto B_seq = past_lens.size(0);
+        size_t max_kv_len_in_blocks = 0;
+        for (size_t b = 0; b < B_seq; b++) {
+            auto q_len = subsequence_begins.ptr<int32_t>()[b + 1] - subsequence_begins.ptr<int32_t>()[b];
+            auto kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b] + q_len);
+            max_kv_len_in_blocks = std::max(max_kv_len_in_blocks, div_up(kv_len, _block_size));
+        }
+        _sparse_decode_mask.resize<uint8_t>({B_seq, max_kv_len_in_blocks});
+        sparse_attention_mask.resize(B_seq);
+        _cpu_parallel->parallel_for(B_seq, [&](size_t b) {
+            auto q_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1] -
+                                             subsequence_begins.ptr<int32_t>()[b]);
+            auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[b]);
+            auto kv_len_in_blocks = div_up(past_len + q_len, _block_size);
+            if (q_len == 1) {
+                auto* row = _sparse_decode_mask.ptr<uint8_t>(b);
+                for (size_t k_blk = 0; k_blk < kv_len_in_blocks; k_blk++) {
+                    row[k_blk] = is_kv_block_attended(k_blk, past_len) ? 1 : 0;
+                }
+                return;
+            }
+            auto q_len_in_blocks = div_up(q_len, _block_size);
+            auto& mask = sparse_attention_mask[b];
+            mask.resize({H, q_len_in_blocks, kv_len_in_blocks}, sizeof(bool), ov::element::Type_t::boolean);
+            for (size_t q_blk = 0; q_blk < q_len_in_blocks; q_blk++) {
+                auto* row = mask.ptr<bool>(0, q_blk);
+                for (size_t k_blk = 0; k_blk < kv_len_in_blocks; k_blk++) {
+                    row[k_blk] = is_kv_block_attended(k_blk, past_len + q_blk * _block_size);
+                }
+            }
+            for (size_t h = 1; h < H; h++) {
+                std::memcpy(mask.ptr<bool>(h), mask.ptr<bool>(0), q_len_in_blocks * kv_len_in_blocks * sizeof(bool));
+            }
+        });
+        _sparse_mask_block_size = _block_size;
+        _use_softmax_sparse_mask = true;
+        _sparse_pattern_active = true;
+    }
+
+    uint8_t* get_sparse_decode_mask(size_t batch_in_seq) {
+        return _sparse_pattern_active ? _sparse_decode_mask.ptr<uint8_t>(batch_in_seq) : nullptr;
+    }
+
     void init_score_buffers(const PlainTensor& past_lens,
                             const PlainTensor& subsequence_begins,
                             const PlainTensor& score_aggregation_window) {
@@ -894,6 +957,7 @@ struct MHAHelper {
                 q_is_xf16 ? _output.ptr<float>(ithr, 0, h, 0) : output_emb.ptr<float>(q_start, h * SV);
 
             // for each weight block, loop through all value block
+            bool is_first_v_blk = true;
             for (size_t v_blk = 0; v_blk < cur_kv_len_blocks; v_blk++) {
                 // sparse attention mask filtering for value blocks
                 if (!sparse_attention_mask.empty() && sparse_attention_mask[batch_in_seq].ptr_v() != nullptr) {
@@ -908,7 +972,9 @@ struct MHAHelper {
                 } else {
                     v_ptr = present_value.ptr<DATA_TYPE>(block_table[v_blk], hk);
                 }
-                if (v_blk == 0) {
+                if (is_first_v_blk) {
+                    // the first attended block initializes the output, the skipped blocks may include block 0
+                    is_first_v_blk = false;
                     _wv_gemm[q_cnt - 1]->executeGemm(q_cnt < _block_size,
                                                      w_ptr + v_blk * _block_size,
                                                      v_ptr,
@@ -1108,11 +1174,15 @@ struct MHAHelper {
                             size_t cur_kv_len,
                             const PlainTensor& alibi_slopes,
                             float* score_output,
-                            const PlainTensor& sinks) {
+                            const PlainTensor& sinks,
+                            uint8_t* sparse_block_mask = nullptr) {
 #    if defined(OPENVINO_ARCH_X86_64)
         if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
             _gemv->tile_config();
             for (size_t pk = 0, i = 0; pk < cur_kv_len; pk += _block_size, i++) {
+                if (sparse_block_mask && !sparse_block_mask[i]) {
+                    continue;
+                }
                 auto block_number = block_table[i];
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = hq_beg; h < hq_end; h++) {
@@ -1127,6 +1197,9 @@ struct MHAHelper {
         } else {
 #    endif
             for (size_t pk = 0, i = 0; pk < cur_kv_len; pk += _block_size, i++) {
+                if (sparse_block_mask && !sparse_block_mask[i]) {
+                    continue;
+                }
                 auto block_number = block_table[i];
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = hq_beg; h < hq_end; h++) {
@@ -1208,7 +1281,9 @@ struct MHAHelper {
                                                ov::element::f32,
                                                ov::element::f32,
                                                sink,
-                                               alibi_slope);
+                                               alibi_slope,
+                                               sparse_block_mask,
+                                               _block_size);
                 }
                 if (score_output) {
                     // aligned to cache line to avoid false sharing
@@ -1222,6 +1297,9 @@ struct MHAHelper {
 
         memset(_output.ptr<float>(ithr), 0, q_len * H * SV * sizeof(float));
         for (size_t pv = 0, i = 0; pv < cur_kv_len; pv += _block_size, i++) {
+            if (sparse_block_mask && !sparse_block_mask[i]) {
+                continue;
+            }
             auto block_number = block_table[i];
             for (size_t pq = 0; pq < q_len; pq++) {
                 for (size_t h = hq_beg; h < hq_end; h++) {
@@ -1319,9 +1397,10 @@ struct MHAHelper {
             size_t hq_end = 0;
             get_h_params(loop_hk, hx, _h_each_group_len, hq_beg, hq_end, hk);
 
-            // kv_len must be valid
+            // kv_len must be valid and the block attended
             auto pk = pk_in_blocks * _block_size;
-            if (pk < context_len) {
+            auto* sparse_block_mask = get_sparse_decode_mask(b);
+            if (pk < context_len && (!sparse_block_mask || sparse_block_mask[pk_in_blocks])) {
                 auto block_number = block_indices.ptr<int32_t>()[block_indices_begins.ptr<int32_t>()[b] + pk_in_blocks];
 #    if defined(OPENVINO_ARCH_X86_64)
                 if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
@@ -1419,7 +1498,9 @@ struct MHAHelper {
                                            ov::element::f32,
                                            ov::element::f32,
                                            sink,
-                                           alibi_slope);
+                                           alibi_slope,
+                                           get_sparse_decode_mask(b),
+                                           _block_size);
             }
         };
 
@@ -1461,8 +1542,9 @@ struct MHAHelper {
             size_t hq_end = 0;
             get_h_params(loop_hk, hx, _h_each_group_len, hq_beg, hq_end, hk);
 
-            // kv_len must be valid
-            if (pv < context_len) {
+            // kv_len must be valid and the block attended
+            auto* sparse_block_mask = get_sparse_decode_mask(b);
+            if (pv < context_len && (!sparse_block_mask || sparse_block_mask[pv_in_blocks])) {
                 auto block_number = block_indices.ptr<int32_t>()[block_indices_begins.ptr<int32_t>()[b] + pv_in_blocks];
                 for (size_t pq = 0; pq < q_len; pq++) {
                     for (size_t h = hq_beg; h < hq_end; h++) {
@@ -1675,7 +1757,6 @@ struct MHA {
                         score_output = _helper._score_output.template ptr<float>() + score_offset * _helper.H;
                     }
                 }
-                // TODO: support second token sparse attention execution
                 _helper.exec_kernel_one_bh(
                     q.slice(0, batch_in_token, batch_in_token),
                     k_cache,
@@ -1690,7 +1771,8 @@ struct MHA {
                     cur_kv_len,
                     alibi_slopes,
                     score_output,
-                    sinks);
+                    sinks,
+                    _helper.get_sparse_decode_mask(batch_in_seq));
             } else {
                 const auto batch_in_reorder = item.batch_in_reorder;
                 const auto q_blk = item.q_block_id;
@@ -1851,7 +1933,6 @@ struct MHA {
                             sinks,
                             sparse_attention_mask);
         } else {
-            // TODO: support second token sparse attention execution
             _helper.exec_loop_bhl(query,
                                   present_key,
                                   present_value,
@@ -2181,6 +2262,14 @@ struct AttentionExecutor : public PagedAttentionExecutor {
                      max_context_len,
                      static_cast<bool>(alibi_slopes),
                      init_rotation_coefficient_scratch);
+
+        _helper._sparse_pattern_active = false;
+#    if defined(OPENVINO_ARCH_X86_64)
+        // the mask estimated by XAttention takes precedence over the static pattern
+        if (_helper.is_sparse_pattern_enabled() && sparse_attention_mask.empty()) {
+            _helper.init_sparse_pattern(past_lens, subsequence_begins, sparse_attention_mask);
+        }
+#    endif
     }
 
     void concat_pastkv(const PlainTensor& k,
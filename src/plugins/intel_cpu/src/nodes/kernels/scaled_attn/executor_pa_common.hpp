@@ -5,6 +5,7 @@
 
 #include <xbyak/xbyak.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <openvino/core/type/element_type.hpp>
@@ -57,6 +58,10 @@ struct PagedAttnQuantParams {
     bool quant_key_bychannel = false;
     bool quant_value_bychannel = false;
     bool is_sage_attn = false;
+    // static block-sparse attention pattern, disabled when sparse_local_blocks is 0
+    size_t sparse_local_blocks = 0UL;
+    size_t sparse_sink_tokens = 0UL;
+    size_t sparse_global_stride = 0UL;
 };
 
 struct AttnWorkItem {
@@ -131,6 +136,21 @@ public:
             }
             total_kv_len += kv_len;
         }
+        // the attention items are picked by a dynamic schedule: start with the expensive ones, i.e. the last query
+        // blocks of the long prompts which attend over the longest context, so the cheap decode items fill the tail
+        // instead of waiting for a prompt block issued last
+        auto get_cost = [&](const AttnWorkItem& item) {
+            auto past_len = static_cast<int64_t>(past_lens.ptr<int32_t>()[item.batch_in_seq]);
+            if (item.q_len == 1) {
+                return past_len + 1;
+            }
+            auto q_begin = static_cast<int64_t>(item.q_block_id) * static_cast<int64_t>(block_size);
+            auto q_cnt = std::min(static_cast<int64_t>(block_size), item.q_len - q_begin);
+            return q_cnt * (past_len + q_begin + q_cnt);
+        };
+        std::stable_sort(attn_items.begin(), attn_items.end(), [&](const AttnWorkItem& a, const AttnWorkItem& b) {
+            return get_cost(a) > get_cost(b);
+        });
     }
     [[nodiscard]] const AttnWorkItem& get_attn_work_item(size_t idx) const {
         return attn_items[idx];
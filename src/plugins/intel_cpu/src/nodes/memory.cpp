@@ -948,9 +948,14 @@ MemoryInputSDPA::MemoryInputSDPA(const std::string& id,
                                  const GraphContext::CPtr& context,
                                  const std::optional<std::vector<Shape>>& input_shape,
                                  const std::optional<std::vector<ov::element::Type>>& input_prc,
-                                 const std::shared_ptr<ScaledDotProductAttention>& sdpaNode)
+                                 const std::shared_ptr<ScaledDotProductAttention>& sdpaNode,
+                                 const std::vector<std::shared_ptr<ScaledDotProductAttention>>& sdpaReaders)
     : MemoryInputBase(id, name, type, output_shape, output_prc, context, input_shape, input_prc),
-      m_sdpaNode(sdpaNode) {}
+      m_sdpaNode(sdpaNode) {
+    for (const auto& reader : sdpaReaders) {
+        m_sdpaReaders.emplace_back(reader, -1);
+    }
+}
 
 void MemoryInputSDPA::createPrimitive() {
     MemoryInputBase::createPrimitive();
@@ -965,6 +970,17 @@ void MemoryInputSDPA::createPrimitive() {
         }
     }
     CPU_NODE_ASSERT(m_child_port_idx != -1, getName(), " should be connected to SDPA node.");
+
+    for (auto& [reader, port_idx] : m_sdpaReaders) {
+        auto readerNode = reader.lock();
+        for (auto&& edge : getChildEdgesAtPort(0)) {
+            if (edge->getChild() == readerNode) {
+                port_idx = edge->getOutputNum();
+                break;
+            }
+        }
+        CPU_NODE_ASSERT(port_idx != -1, getName(), " should be connected to the KV cache reader SDPA node.");
+    }
 }
 
 void MemoryInputSDPA::assignStateHook() {
@@ -974,6 +990,11 @@ void MemoryInputSDPA::assignStateHook() {
     auto sdpaState = std::dynamic_pointer_cast<VariableStateKVcache>(currentState);
     CPU_NODE_ASSERT(sdpaState, "Unexpected state type: ", currentState->get_name());
     sdpaNode->assignState(sdpaState, m_child_port_idx);
+    for (const auto& [reader, port_idx] : m_sdpaReaders) {
+        auto readerNode = reader.lock();
+        CPU_NODE_ASSERT(readerNode, "SDPA reader node is not available");
+        readerNode->assignState(sdpaState, port_idx);
+    }
 }
 
 MemStatePtr MemoryInputSDPA::makeState() const {
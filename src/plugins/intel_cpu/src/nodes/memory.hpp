@@ -11,6 +11,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
@@ -281,7 +282,8 @@ public:
                     const GraphContext::CPtr& context,
                     const std::optional<std::vector<Shape>>& input_shape,
                     const std::optional<std::vector<ov::element::Type>>& input_prc,
-                    const std::shared_ptr<ScaledDotProductAttention>& sdpaNode);
+                    const std::shared_ptr<ScaledDotProductAttention>& sdpaNode,
+                    const std::vector<std::shared_ptr<ScaledDotProductAttention>>& sdpaReaders = {});
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
@@ -297,5 +299,7 @@ private:
 
     std::weak_ptr<ScaledDotProductAttention> m_sdpaNode;
     int m_child_port_idx = -1;
+    // SDPA nodes of other layers attending over the same KV cache (cross-layer sharing)
+    std::vector<std::pair<std::weak_ptr<ScaledDotProductAttention>, int>> m_sdpaReaders;
 };
 }  // namespace ov::intel_cpu::node
@@ -4,21 +4,27 @@
 
 #include "multinomial.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <ctime>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <openvino/core/type.hpp>
 #include <openvino/op/constant.hpp>
 #include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/philox.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -27,6 +33,7 @@
 #include "openvino/op/multinomial.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "utils/bfloat16.hpp"
+#include "utils/cpp/bit_cast.hpp"
 #include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
@@ -127,10 +134,8 @@ void Multinomial::prepareParams() {
 
     m_batches_count = probs_shape[0];
     m_probs_count = probs_shape[1];
-    m_samples_probs_count = m_samples_count * m_probs_count;
     m_input_elements_count = m_batches_count * m_probs_count;
     m_output_elements_count = m_batches_count * m_samples_count;
-    m_batches_samples_probs_count = m_output_elements_count * m_probs_count;
 }
 
 bool Multinomial::neverExecute() const {
@@ -179,108 +184,144 @@ void Multinomial::execute_probs_type() {
     }
 }
 
+namespace {
+
+// uniform value in [0, 1) built from the random bits the same way as RandomUniform does for the probs precision
+inline float uniform_from_bits(uint32_t bits, [[maybe_unused]] float tag) {
+    return bit_cast<float>(0x3f800000U | (bits & 0x7fffffU)) - 1.F;
+}
+
+inline float uniform_from_bits(uint32_t bits, [[maybe_unused]] float16 tag) {
+    const auto x_uint16 = static_cast<uint16_t>(bits);
+    return static_cast<float>(bit_cast<float16>(static_cast<uint16_t>(0x3c00U | (x_uint16 & 0x03ffU)))) - 1.F;
+}
+
+inline float uniform_from_bits(uint32_t bits, [[maybe_unused]] bfloat16_t tag) {
+    const auto x_uint16 = static_cast<uint16_t>(bits);
+    return static_cast<float>(bit_cast<bfloat16_t>(static_cast<uint16_t>(0x3f80U | (x_uint16 & 0x7fU)))) - 1.F;
+}
+
+}  // namespace
+
+// The samples are drawn from the counter-based Philox sequence of RandomUniform (global_seed is the key and op_seed
+// is the counter), so the results for the given seeds are the same as the ones of the reference implementation.
+template <typename P>
+void Multinomial::generate_random_samples(float* samples) const {
+    // When both seed values are equal to zero the sequence should be non-deterministic.
+    const uint64_t key = all_of(0U, m_global_seed, m_op_seed) ? std::random_device{}() : m_global_seed;
+    const auto groups_count = div_up(m_output_elements_count, philox::GROUP_SIZE);
+    context->getCpuParallel()->parallel_for(groups_count, [&](size_t group) {
+        uint32_t res[philox::GROUP_SIZE];
+        philox::runPhilox(key, m_op_seed, group, res);
+        const auto start = group * philox::GROUP_SIZE;
+        const auto count = std::min(philox::GROUP_SIZE, m_output_elements_count - start);
+        for (size_t i = 0; i < count; ++i) {
+            samples[start + i] = uniform_from_bits(res[i], P{});
+        }
+    });
+}
+
 template <typename P, typename O>
 void Multinomial::execute_convert_type() {
     const auto* probs = getSrcDataAtPortAs<const P>(PROBS_PORT);
     auto* output = getDstDataAtPortAs<O>(OUTPUT_PORT);
     const auto& cpu_parallel = context->getCpuParallel();
 
-    std::vector<P> m_cdf(m_input_elements_count);
-    std::vector<P> m_max_per_batch(m_batches_count);
-    std::vector<P> m_random_samples(m_output_elements_count);
-
-    // exp & cumsum
+    // The cdf is accumulated in f32 and is not normalized: the sum of the row scales the random sample instead.
+    std::vector<float> cdf(m_input_elements_count);
+    std::vector<float> random_samples(m_output_elements_count);
+    generate_random_samples<P>(random_samples.data());
+
+    // a few rows of a large vocabulary are split into chunks, the partial sums of the chunks are fixed up afterwards
+    const auto nthr = static_cast<size_t>(cpu_parallel->get_num_threads());
+    const size_t chunks_count =
+        std::max<size_t>(1, std::min(div_up(nthr, m_batches_count), m_probs_count / CDF_MIN_CHUNK_SIZE));
+    const size_t chunk_size = div_up(m_probs_count, chunks_count);
+    std::vector<float> chunk_values(m_batches_count * chunks_count);
+    auto get_chunk_range = [&](size_t idx_chunk) {
+        const auto begin = std::min(idx_chunk * chunk_size, m_probs_count);
+        return std::make_pair(begin, std::min(begin + chunk_size, m_probs_count));
+    };
+
+    // the maximum is subtracted from the log probabilities to keep exp() finite
+    std::vector<float> max_per_batch(m_batches_count, 0.F);
     if (m_log_probs) {
-        cpu_parallel->parallel_for(m_batches_count, [&](size_t idx) {
-            const auto start_idx = idx * m_probs_count;
-            m_cdf[start_idx] = std::exp(probs[start_idx]);
-            for (size_t prev = start_idx, curr = prev + 1; curr < (start_idx + m_probs_count); ++prev, ++curr) {
-                m_cdf[curr] = std::exp(probs[curr]) + m_cdf[prev];
+        cpu_parallel->parallel_for2d(m_batches_count, chunks_count, [&](size_t idx_batch, size_t idx_chunk) {
+            const auto [begin, end] = get_chunk_range(idx_chunk);
+            const auto* src = probs + idx_batch * m_probs_count;
+            auto max_value = -std::numeric_limits<float>::infinity();
+            for (size_t idx_prob = begin; idx_prob < end; ++idx_prob) {
+                max_value = std::max(max_value, static_cast<float>(src[idx_prob]));
             }
+            chunk_values[idx_batch * chunks_count + idx_chunk] = max_value;
         });
-    } else {
-        cpu_parallel->parallel_for(m_batches_count, [&](size_t idx_batch) {
-            const auto start_idx = idx_batch * m_probs_count;
-            const auto* probs_start_idx = probs + start_idx;
-            std::partial_sum(probs_start_idx, probs_start_idx + m_probs_count, m_cdf.begin() + start_idx);
-        });
-    }
-
-    // TODO RandomUniform - should use RandomUniform kernel to match other frameworks' seed results
-    std::mt19937 gen;
-    if (all_of(0U, m_global_seed, m_op_seed)) {
-        gen.seed(std::time(nullptr));
-    } else {
-        std::seed_seq seed{m_global_seed, m_op_seed};
-        gen.seed(seed);
+        for (size_t idx_batch = 0; idx_batch < m_batches_count; ++idx_batch) {
+            const auto* values = chunk_values.data() + idx_batch * chunks_count;
+            const auto max_value = *std::max_element(values, values + chunks_count);
+            max_per_batch[idx_batch] = std::isfinite(max_value) ? max_value : 0.F;
+        }
     }
 
-    const auto gen_max = static_cast<float>(std::mt19937::max());
-    std::generate(m_random_samples.begin(), m_random_samples.end(), [&]() {
-        return static_cast<P>(static_cast<float>(gen()) / gen_max);
-    });
-
-    // max & divide
-    const auto min_value_of_max = std::numeric_limits<P>::min();
-    cpu_parallel->parallel_for(m_batches_count, [&](size_t idx) {
-        m_max_per_batch[idx] = std::max(m_cdf[(idx + 1) * m_probs_count - 1], min_value_of_max);
-    });
-
-    cpu_parallel->parallel_for(m_input_elements_count, [&](size_t idx) {
-        size_t idx_max_elem = idx / m_probs_count;
-        m_cdf[idx] = m_cdf[idx] / m_max_per_batch[idx_max_elem];
+    // exp & cumsum
+    cpu_parallel->parallel_for2d(m_batches_count, chunks_count, [&](size_t idx_batch, size_t idx_chunk) {
+        const auto [begin, end] = get_chunk_range(idx_chunk);
+        const auto* src = probs + idx_batch * m_probs_count;
+        auto* dst = cdf.data() + idx_batch * m_probs_count;
+        float sum = 0.F;
+        if (m_log_probs) {
+            const auto max_value = max_per_batch[idx_batch];
+            for (size_t idx_prob = begin; idx_prob < end; ++idx_prob) {
+                sum += std::exp(static_cast<float>(src[idx_prob]) - max_value);
+                dst[idx_prob] = sum;
+            }
+        } else {
+            for (size_t idx_prob = begin; idx_prob < end; ++idx_prob) {
+                sum += static_cast<float>(src[idx_prob]);
+                dst[idx_prob] = sum;
+            }
+        }
+        chunk_values[idx_batch * chunks_count + idx_chunk] = sum;
     });
-
-    if (m_with_replacement) {
-        cpu_parallel->parallel_for(m_batches_samples_probs_count, [&](size_t idx) {
-            size_t idx_batch = idx / m_samples_probs_count;
-            size_t idx_num_samples_probs = idx % m_samples_probs_count;
-            size_t idx_prob = idx_num_samples_probs % m_probs_count;
-            size_t idx_sample = idx_num_samples_probs / m_probs_count;
-
-            size_t idx_input = idx_batch * m_probs_count + idx_prob;
-            size_t idx_output = idx_batch * m_samples_count + idx_sample;
-            if (m_random_samples[idx_output] <= m_cdf[idx_input] &&
-                (!idx_prob || m_random_samples[idx_output] > m_cdf[idx_input - 1])) {
-                output[idx_output] = static_cast<O>(idx_prob);
+    if (chunks_count > 1) {
+        for (size_t idx_batch = 0; idx_batch < m_batches_count; ++idx_batch) {
+            auto* values = chunk_values.data() + idx_batch * chunks_count;
+            std::exclusive_scan(values, values + chunks_count, values, 0.F);
+        }
+        cpu_parallel->parallel_for2d(m_batches_count, chunks_count - 1, [&](size_t idx_batch, size_t idx_chunk) {
+            const auto [begin, end] = get_chunk_range(idx_chunk + 1);
+            const auto offset = chunk_values[idx_batch * chunks_count + idx_chunk + 1];
+            auto* dst = cdf.data() + idx_batch * m_probs_count;
+            for (size_t idx_prob = begin; idx_prob < end; ++idx_prob) {
+                dst[idx_prob] += offset;
             }
         });
-    } else {  // without replacement - adjust cdf after each sample drawn from batch, sequentially
-        cpu_parallel->parallel_for(m_batches_count, [&](size_t idx_batch) {
-            for (size_t idx_sample = 0LU; idx_sample < m_samples_count; ++idx_sample) {
-                size_t idx_input = idx_batch * m_probs_count;
-                size_t idx_output = idx_batch * m_samples_count + idx_sample;
-
-                bool class_selected = false;
-                size_t selected_class = m_probs_count;
-                P sample_value = m_random_samples[idx_output];
-                for (size_t idx_prob = 0LU; idx_prob < m_probs_count; ++idx_prob) {
-                    if (sample_value <= m_cdf[idx_input + idx_prob]) {
-                        output[idx_output] = static_cast<O>(idx_prob);
-                        selected_class = idx_prob;
-                        class_selected = true;
-                        break;
-                    }
-                }
+    }
+
+    // the first class whose cdf reaches the sample, found by a binary search since the cdf is not decreasing
+    const auto min_value_of_max = std::numeric_limits<float>::min();
+    cpu_parallel->parallel_for(m_batches_count, [&](size_t idx_batch) {
+        auto* row = cdf.data() + idx_batch * m_probs_count;
+        auto total = std::max(row[m_probs_count - 1], min_value_of_max);
+        for (size_t idx_sample = 0LU; idx_sample < m_samples_count; ++idx_sample) {
+            const size_t idx_output = idx_batch * m_samples_count + idx_sample;
+            const auto sample_value = random_samples[idx_output] * total;
+            const auto selected_class =
+                static_cast<size_t>(std::lower_bound(row, row + m_probs_count, sample_value) - row);
+            if (selected_class == m_probs_count) {
+                continue;
+            }
+            output[idx_output] = static_cast<O>(selected_class);
 
-                if (class_selected) {
-                    P class_probability = [&]() -> P {
-                        if (selected_class) {
-                            return m_cdf[idx_input + selected_class] - m_cdf[idx_input + selected_class - 1];
-                        }
-                        return m_cdf[idx_input];
-                    }();
-                    P divisor = 1 - class_probability;
-                    for (size_t idx_prob = 0LU; idx_prob < m_probs_count; ++idx_prob) {
-                        if (idx_prob >= selected_class) {
-                            m_cdf[idx_input + idx_prob] = m_cdf[idx_input + idx_prob] - class_probability;
-                        }
-                        m_cdf[idx_input + idx_prob] = m_cdf[idx_input + idx_prob] / divisor;
-                    }
+            // without replacement - remove the probability of the class drawn from the cdf
+            if (!m_with_replacement) {
+                const auto class_probability = selected_class ? row[selected_class] - row[selected_class - 1] : row[0];
+                for (size_t idx_prob = selected_class; idx_prob < m_probs_count; ++idx_prob) {
+                    row[idx_prob] -= class_probability;
                 }
+                total = std::max(total - class_probability, min_value_of_max);
             }
-        });
-    }
+        }
+    });
 }
 
 }  // namespace ov::intel_cpu::node
@@ -68,14 +68,18 @@ private:
     size_t m_probs_count = 0;
     size_t m_batches_count = 0;
     size_t m_samples_count = 0;
-    size_t m_samples_probs_count = 0;
     size_t m_input_elements_count = 0;
     size_t m_output_elements_count = 0;
-    size_t m_batches_samples_probs_count = 0;
+
+    // rows of the large vocabularies are split into chunks of at least this size to build the cdf in parallel
+    static constexpr size_t CDF_MIN_CHUNK_SIZE = 4096LU;
 
     template <typename P>
     void execute_probs_type();
 
+    template <typename P>
+    void generate_random_samples(float* samples) const;
+
     template <typename P, typename O>
     void execute_convert_type();
 };
@@ -249,7 +249,10 @@ void PagedAttention::createPrimitive() {
                                     cpuConfig.valueCacheGroupSize,
                                     quantKeybyChannel,
                                     quantValuebyChannel,
-                                    cpuConfig.enableSageAttn};
+                                    cpuConfig.enableSageAttn,
+                                    cpuConfig.sparseAttnLocalBlocks,
+                                    cpuConfig.sparseAttnSinkTokens,
+                                    cpuConfig.sparseAttnGlobalStride};
         return make_pa_executor(rtPrecision, kCachePrecision, vCachePrecision, params, context->getCpuParallel());
 #else
         return nullptr;
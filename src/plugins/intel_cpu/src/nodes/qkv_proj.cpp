@@ -111,10 +111,13 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         works.resize(m_threads_num);
 
         int cur_work_id = 0;
+        // outputs with fused RoPE are split on head boundaries, so each work rotates whole heads
+        const bool with_rope = m_node->m_config.rope_rotary_ndims > 0;
         auto create_works = [&](void* pw, int output_id, int N, int valid_nthr) {
+            const int blk_N_size = (with_rope && output_id < 2) ? m_node->m_config.rope_head_size : REG_BLK_N_SIZE;
             // split task on more cores is better on TBB
-            OPENVINO_ASSERT((N % REG_BLK_N_SIZE) == 0);
-            auto num_blk_N = N / REG_BLK_N_SIZE;
+            OPENVINO_ASSERT((N % blk_N_size) == 0);
+            auto num_blk_N = N / blk_N_size;
             auto blkN_per_thread = (num_blk_N) / valid_nthr;
             auto blkN_leftover = num_blk_N - (blkN_per_thread * valid_nthr);
             auto start_blkN = 0;
@@ -128,9 +131,9 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                 if (blkN) {
                     auto& work = works[cur_work_id++];
                     work.blk_K_size = cache_blk_k_size;
-                    work.n0 = (start_blkN)*REG_BLK_N_SIZE;
-                    work.n1 = (start_blkN + blkN) * REG_BLK_N_SIZE;
-                    work.BN = blkN * REG_BLK_N_SIZE;
+                    work.n0 = (start_blkN)*blk_N_size;
+                    work.n1 = (start_blkN + blkN) * blk_N_size;
+                    work.BN = blkN * blk_N_size;
                     work.k0 = 0;
                     work.k1 = cache_blk_k_size * num_blk_K;
                     work.output_id = output_id;
@@ -258,6 +261,67 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         auto stride_dst_1 = dstStrides1[1];
         auto stride_dst_2 = dstStrides2[1];
 
+        // with fused RoPE, Q & K are rotated in the f32 accumulation tile and stored as [B, H, L, S]
+        const bool with_rope = m_node->m_config.rope_rotary_ndims > 0;
+        const int seq_len = static_cast<int>(ishape[1]);
+        const int head_size = m_node->m_config.rope_head_size;
+        const int rotary_ndims = m_node->m_config.rope_rotary_ndims;
+        const int half_rotary_ndims = rotary_ndims / 2;
+        const int cos_sin_offset = (m_node->m_config.rope_cos_sin_ndims == half_rotary_ndims) ? 0 : half_rotary_ndims;
+        T* const rope_dst[2] = {dst0, dst1};
+        const int rope_head_cnt[2] = {m_node->m_config.proj_size0 / std::max(head_size, 1),
+                                      m_node->m_config.proj_size1 / std::max(head_size, 1)};
+        PlainTensor t_cos;
+        PlainTensor t_sin;
+        if (with_rope) {
+            const auto rope_port = m_node->getOriginalInputsNumber() - 2;
+            t_cos.reset(m_node->getSrcMemoryAtPort(rope_port));
+            t_sin.reset(m_node->getSrcMemoryAtPort(rope_port + 1));
+            if (t_cos.m_rank == 2) {
+                t_cos = t_cos.reshape({1, 1, t_cos.size(0), t_cos.size(1)});
+                t_sin = t_sin.reshape({1, 1, t_sin.size(0), t_sin.size(1)});
+            } else if (t_cos.m_rank == 3) {
+                t_cos = t_cos.reshape({1, t_cos.size(0), t_cos.size(1), t_cos.size(2)});
+                t_sin = t_sin.reshape({1, t_sin.size(0), t_sin.size(1), t_sin.size(2)});
+            }
+        }
+
+        auto apply_rope = [&](float* C, size_t stride_C, int m0, int BM, int BN) {
+            for (int r = 0; r < BM; r++) {
+                const auto b = static_cast<size_t>((m0 + r) / seq_len);
+                const auto p = static_cast<size_t>((m0 + r) % seq_len);
+                const auto* cos = &t_cos.at<float>({b, 0, p, 0}, true);
+                const auto* sin = &t_sin.at<float>({b, 0, p, 0}, true);
+                for (int h = 0; h < BN; h += head_size) {
+                    auto* x = C + r * stride_C + h;
+                    for (int i = 0; i < half_rotary_ndims; i++) {
+                        auto x0 = x[i];
+                        auto x1 = x[i + half_rotary_ndims];
+                        x[i] = cos[i] * x0 - sin[i] * x1;
+                        x[i + half_rotary_ndims] = cos[i + cos_sin_offset] * x1 + sin[i + cos_sin_offset] * x0;
+                    }
+                }
+            }
+        };
+
+        // rows of the tile are tokens [m0, m0 + BM) of the flattened [B, L] dims, each contiguous run
+        // of tokens of the same batch is stored with stride head_size into every head of the work
+        auto store_rope = [&](float* C, size_t stride_C, int m0, int BM, const Work& work) {
+            const auto H = rope_head_cnt[work.output_id];
+            for (int r = 0; r < BM;) {
+                const int b = (m0 + r) / seq_len;
+                const int p = (m0 + r) % seq_len;
+                const int rows = std::min(BM - r, seq_len - p);
+                for (int n = 0; n < work.BN; n += head_size) {
+                    const int h = (work.n0 + n) / head_size;
+                    auto* dst = rope_dst[work.output_id] +
+                                ((static_cast<size_t>(b) * H + h) * seq_len + p) * static_cast<size_t>(head_size);
+                    jit_cvt.call(C + r * stride_C + n, stride_C, dst, head_size, rows, head_size);
+                }
+                r += rows;
+            }
+        };
+
         auto asym = true;
         for (int m = 0; m < M;) {
             int BM = std::min(M - m, CACHE_BLK_M_SIZE);
@@ -315,6 +379,11 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                                                                                w_scale[work.output_id] + work.n0,
                                                                                asym);
                     }
+                    if (with_rope && work.output_id < 2) {
+                        apply_rope(src, stride_src, m, BM, work.BN);
+                        store_rope(src, stride_src, m, BM, work);
+                        return;
+                    }
                     // compress accumulation result into target
                     jit_cvt.call(src, stride_src, dst, stride_dst, BM, work.BN);
                 }
@@ -435,6 +504,12 @@ void QKVProjection::initSupportedPrimitiveDescriptors() {
         outPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getOutputShapeAtPort(2), false, -1);
     }
 
+    if (m_config.rope_rotary_ndims > 0) {
+        const auto rope_port = getOriginalInputsNumber() - 2;
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(rope_port), false, -1);
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(rope_port + 1), false, -1);
+    }
+
     addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
 }
 
@@ -488,6 +563,10 @@ bool QKVProjection::isSupportedOperation([[maybe_unused]] const std::shared_ptr<
                 errorMessage = "QKVProjection 3rd proj output channel size is not multiple of register blocking size";
                 return false;
             }
+            if (config.rope_rotary_ndims > 0 && (config.rope_head_size % REG_BLK_N_SIZE) != 0) {
+                errorMessage = "QKVProjection fused RoPE head size is not multiple of register blocking size";
+                return false;
+            }
         } else {
             errorMessage = "Only QKVProjection operation is supported";
             return false;
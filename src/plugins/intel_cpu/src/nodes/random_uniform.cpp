@@ -23,6 +23,7 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/philox.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -46,13 +47,6 @@
 
 namespace ov::intel_cpu::node {
 
-// Following const values are taken from the original paper:
-// https://www.thesalmons.org/john/random123/papers/random123sc11.pdf
-constexpr uint32_t CRUSH_RESISTANCE_CONST_LOWER_VALUE = 0x9E3779B9;
-constexpr uint32_t CRUSH_RESISTANCE_CONST_UPPER_VALUE = 0xBB67AE85;
-constexpr uint64_t STATISTIC_MAXIMIZING_MULTIPLIER_N = 0xD2511F53;
-constexpr uint64_t STATISTIC_MAXIMIZING_MULTIPLIER_COUNTER = 0xCD9E8D57;
-
 // Following const values are taken from the original paper (used by PyTorch):
 // https://dl.acm.org/doi/pdf/10.1145/272991.272995
 constexpr int32_t MERSENNE_STATE_N = 624;
@@ -463,52 +457,6 @@ void RandomUniform::prepareGeneratorKernel() {
 
 namespace {
 
-inline void calculateRound(const uint32_t* key, uint32_t* counter, uint32_t* n) {
-    uint64_t prod_0 = STATISTIC_MAXIMIZING_MULTIPLIER_N * n[0];
-    uint64_t prod_1 = STATISTIC_MAXIMIZING_MULTIPLIER_COUNTER * counter[0];
-    n[0] = static_cast<uint32_t>(prod_1 >> 32) ^ n[1] ^ key[0];
-    n[1] = static_cast<uint32_t>(prod_1);
-    counter[0] = static_cast<uint32_t>(prod_0 >> 32) ^ counter[1] ^ key[1];
-    counter[1] = static_cast<uint32_t>(prod_0);
-}
-
-inline void raiseKey(uint32_t* key) {
-    key[0] += CRUSH_RESISTANCE_CONST_LOWER_VALUE;
-    key[1] += CRUSH_RESISTANCE_CONST_UPPER_VALUE;
-}
-
-inline void runPhilox(uint64_t key, uint64_t counter, uint64_t n, uint32_t* res) {
-    auto* key_32 = reinterpret_cast<uint32_t*>(&key);
-    auto* counter_32 = reinterpret_cast<uint32_t*>(&counter);
-    auto* n_32 = reinterpret_cast<uint32_t*>(&n);
-
-    // Loop unwarping for better performance
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-    raiseKey(key_32);
-    calculateRound(key_32, counter_32, n_32);
-
-    res[0] = n_32[0];
-    res[1] = n_32[1];
-    res[2] = counter_32[0];
-    res[3] = counter_32[1];
-}
-
 inline void convertToOutputTypePhilox(const uint32_t* in, float min, float range, float* out, size_t el_to_copy) {
     for (size_t i = 0LU; i < el_to_copy; i++) {
         uint32_t bits = 0x3f800000 | (in[i] & 0x7fffffU);
@@ -604,7 +552,7 @@ std::pair<uint64_t, uint64_t> RandomUniform::computePhilox(void* out,
     case element::P: {                                                                        \
         auto out_t = reinterpret_cast<element_type_traits<element::P>::value_type*>(out_cur); \
         for (; work_rest > 0l; work_rest -= params.step, out_t += params.step) {              \
-            runPhilox(m_global_seed, counter, n, res);                                        \
+            philox::runPhilox(m_global_seed, counter, n, res);                                \
             auto el_to_copy = std::min(params.step, static_cast<uint64_t>(work_rest));        \
             convertToOutputTypePhilox(res, m_min_val.P, m_range_val.P, out_t, el_to_copy);    \
             if (++n == 0) {                                                                   \
@@ -1778,6 +1778,9 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty()) {
         return;
     }
+    // the KV cache states are created from the quantization parameters before the primitive is created, e.g. with the
+    // lazy weights activation, so they must be known once the descriptors are selected
+    initKVCacheQuantParams();
     auto rtPrecision = getRuntimePrecision();
     auto orginSDPInputNumber = getOriginalInputsNumber() - (m_config.config.fuse_concat ? 3 : 0);
 
@@ -1847,12 +1850,16 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
             creatorsMap.at(LayoutType::ncsp)
                 ->createSharedDesc(past_v_input_mem_precision, getInputShapeAtPort(orginSDPInputNumber + 2)));
 
-        config.outConfs[1].setMemDesc(
-            creatorsMap.at(LayoutType::ncsp)->createSharedDesc(past_k_input_mem_precision, getOutputShapeAtPort(1)));
-        config.outConfs[1].inPlace(-1);
-        config.outConfs[2].setMemDesc(
-            creatorsMap.at(LayoutType::ncsp)->createSharedDesc(past_v_input_mem_precision, getOutputShapeAtPort(2)));
-        config.outConfs[2].inPlace(-1);
+        if (!isKVCacheReader()) {
+            config.outConfs[1].setMemDesc(creatorsMap.at(LayoutType::ncsp)
+                                                 ->createSharedDesc(past_k_input_mem_precision,
+                                                                    getOutputShapeAtPort(1)));
+            config.outConfs[1].inPlace(-1);
+            config.outConfs[2].setMemDesc(creatorsMap.at(LayoutType::ncsp)
+                                                 ->createSharedDesc(past_v_input_mem_precision,
+                                                                    getOutputShapeAtPort(2)));
+            config.outConfs[2].inPlace(-1);
+        }
     }
 
     config.outConfs[0].setMemDesc(
@@ -1861,6 +1868,21 @@ void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::undef);
 }
 
+void ScaledDotProductAttention::initKVCacheQuantParams() {
+    const auto& cpuConfig = context->getConfig();
+    const auto keyS = *(getInputShapeAtPort(1).getDims().end() - 1);
+    const auto valueS = *(getInputShapeAtPort(2).getDims().end() - 1);
+
+    m_key_quant_param.groupSize = cpuConfig.keyCacheGroupSize ? cpuConfig.keyCacheGroupSize : keyS;
+    m_key_quant_param.isByChannel = false;
+    if (cpuConfig.keyCacheQuantMode == ov::intel_cpu::Config::CacheQuantMode::BY_CHANNEL) {
+        m_key_quant_param.isByChannel = true;
+    } else if (cpuConfig.keyCacheQuantMode == ov::intel_cpu::Config::CacheQuantMode::BY_TOKEN) {
+        m_key_quant_param.isByChannel = false;
+    }
+    m_value_quant_param.groupSize = cpuConfig.valueCacheGroupSize ? cpuConfig.valueCacheGroupSize : valueS;
+}
+
 void ScaledDotProductAttention::createPrimitive() {
     if (m_config.config.fuse_concat) {
         auto* desc = getSelectedPrimitiveDescriptor();
@@ -1869,18 +1891,10 @@ void ScaledDotProductAttention::createPrimitive() {
     auto rtPrecision = getRuntimePrecision();
     const auto keyDims = getInputShapeAtPort(1).getDims();
     const auto valueDims = getInputShapeAtPort(2).getDims();
-    const auto& cpuConfig = context->getConfig();
     const auto keyS = *(keyDims.end() - 1);
     const auto valueS = *(valueDims.end() - 1);
 
-    m_key_quant_param.groupSize = cpuConfig.keyCacheGroupSize ? cpuConfig.keyCacheGroupSize : keyS;
-    m_key_quant_param.isByChannel = false;
-    if (cpuConfig.keyCacheQuantMode == ov::intel_cpu::Config::CacheQuantMode::BY_CHANNEL) {
-        m_key_quant_param.isByChannel = true;
-    } else if (cpuConfig.keyCacheQuantMode == ov::intel_cpu::Config::CacheQuantMode::BY_TOKEN) {
-        m_key_quant_param.isByChannel = false;
-    }
-    m_value_quant_param.groupSize = cpuConfig.valueCacheGroupSize ? cpuConfig.valueCacheGroupSize : valueS;
+    initKVCacheQuantParams();
     OPENVINO_ASSERT(keyS % m_key_quant_param.groupSize == 0,
                     "ScaledDotProductAttention AttentionExecutor creation fails key state " + std::to_string(keyS) +
                         " cannot be divided by group size " + std::to_string(m_key_quant_param.groupSize));
@@ -1980,8 +1994,11 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     PlainTensor v_scale_zp;
     if (m_config.config.fuse_concat) {
         CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
-        // initialization will be also completed in this func
-        gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
+        // the owner of the states has already appended the current tokens when the cache is shared
+        if (!isKVCacheReader()) {
+            // initialization will be also completed in this func
+            gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
+        }
 
         presentk_input = m_k_state->internal_state_mem();
         presentv_input = m_v_state->internal_state_mem();
@@ -2062,6 +2079,42 @@ void ScaledDotProductAttention::assignState(const std::shared_ptr<VariableStateK
     }
 }
 
+// Slot of the resized cache which holds the token m of the new beam b (slots[m * B + b]). All the beams which read
+// the same source row share the slot of the first of them, so a prefix common to the beams (e.g. the prompt when
+// the batch is expanded to the beam width) is stored once and the slots of the other beams stay untouched.
+static std::vector<int32_t> get_shared_prefix_slots(const PlainTensor& old_beam_table,
+                                                    const int32_t* beam_idx,
+                                                    size_t B,
+                                                    size_t B_state,
+                                                    size_t L0,
+                                                    bool share) {
+    std::vector<int32_t> slots(L0 * B);
+    std::vector<int32_t> owner(B_state);
+    for (size_t m = 0; m < L0; m++) {
+        std::fill(owner.begin(), owner.end(), -1);
+        for (size_t b = 0; b < B; b++) {
+            auto b_kv = static_cast<size_t>(old_beam_table.at<int32_t>({static_cast<size_t>(beam_idx[b]), m}));
+            if (owner[b_kv] < 0 || !share) {
+                owner[b_kv] = static_cast<int32_t>(b);
+            }
+            slots[m * B + b] = owner[b_kv];
+        }
+    }
+    return slots;
+}
+
+// Marks the rows of the cache which are read through the beam table (used[m * B + b]), the rows left behind by the
+// pruned beams or shared with another beam are not worth copying when the cache grows.
+static std::vector<uint8_t> get_used_slots(const PlainTensor& beam_table, size_t B, size_t L0) {
+    std::vector<uint8_t> used(L0 * B, 0);
+    for (size_t b = 0; b < B; b++) {
+        for (size_t m = 0; m < L0; m++) {
+            used[m * B + static_cast<size_t>(beam_table.at<int32_t>({b, m}))] = 1;
+        }
+    }
+    return used;
+}
+
 template <typename T>
 std::vector<T> permute_axes(const std::vector<T>& shape, const std::vector<size_t>& order) {
     std::vector<T> results(shape.size());
@@ -2126,6 +2179,13 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
 
     // 2. resize pastkv
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
+    // the by-channel scales are shared by a group of tokens, which may be split between the slots
+    const bool share_prefix =
+        kvcache_precision != ov::element::u8 || (!m_key_quant_param.isByChannel && !m_value_quant_param.isByChannel);
+    std::vector<int32_t> prefix_slots;
+    if (L0 > 0) {
+        prefix_slots = get_shared_prefix_slots(old_beam_table_k, table, B, B_state, L0, share_prefix);
+    }
     {
         // shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
@@ -2159,6 +2219,9 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             old_past_k = old_past_k.permute(order);
             old_past_v = old_past_v.permute(order);
             cpu_parallel->parallel_for3d(B, H, L0, [&](size_t b, size_t h, size_t m) {
+                if (prefix_slots[m * B + b] != static_cast<int32_t>(b)) {
+                    return;
+                }
                 auto idx = static_cast<size_t>(table[b]);
                 auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
                 memcpy(&new_pastk.at<char>({b, h, m}),
@@ -2210,6 +2273,9 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
                             });
                         } else {
                             cpu_parallel->parallel_for2d(L0, B, [&](size_t m, size_t b) {
+                                if (prefix_slots[m * B + b] != static_cast<int32_t>(b)) {
+                                    return;
+                                }
                                 auto idx = static_cast<size_t>(table[b]);
                                 for (size_t h = 0; h < H; h++) {
                                     auto b_kv = static_cast<size_t>(old_beam_table_k.at<int32_t>({idx, m}));
@@ -2292,8 +2358,9 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
 
         for (size_t b = 0; b < B; b++) {
             for (size_t l = 0; l < L0 + L1; l++) {
-                new_beam_table_k.at<int32_t>({b, l}) = b;
-                new_beam_table_v.at<int32_t>({b, l}) = b;
+                auto slot = l < L0 ? prefix_slots[l * B + b] : static_cast<int32_t>(b);
+                new_beam_table_k.at<int32_t>({b, l}) = slot;
+                new_beam_table_v.at<int32_t>({b, l}) = slot;
             }
         }
 
@@ -2532,7 +2599,9 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             auto real_shape = permute_axes(new_shape, real_order);
             auto mem_desc =
                 std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision, Shape(new_shape), real_shape, real_order);
-            return std::make_shared<Memory>(getEngine(), mem_desc);
+            auto mem_block = std::make_shared<DnnlMemoryBlock>(
+                std::make_unique<MemoryBlockWithReuse>(context->getNumaPlacement(), context->getConfig().hugePages));
+            return std::make_shared<Memory>(getEngine(), mem_desc, mem_block);
         };
 
         auto new_internal_mem_k = new_memory(S);
@@ -2549,7 +2618,17 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
             past_v.reset(internal_mem_v);
             past_k = past_k.permute(order);
             past_v = past_v.permute(order);
-            attn_memcpy(past_k, past_v, new_pastk, new_pastv, cpu_parallel);
+            // the beam table is already updated, only the rows which are still read by a beam are moved
+            PlainTensor beam_table;
+            beam_table.reset(m_k_state->hidden_state_mem());
+            auto used = get_used_slots(beam_table, B, L0);
+            cpu_parallel->parallel_for3d(L0, B, H, [&](size_t m, size_t b, size_t h) {
+                if (!used[m * B + b]) {
+                    return;
+                }
+                memcpy(&new_pastk.at<char>({b, h, m}), &past_k.at<char>({b, h, m}), S * past_k.m_element_size);
+                memcpy(&new_pastv.at<char>({b, h, m}), &past_v.at<char>({b, h, m}), SV * past_v.m_element_size);
+            });
         }
         internal_mem_k = new_internal_mem_k;
         internal_mem_v = new_internal_mem_v;
@@ -56,6 +56,11 @@ public:
 
     void assignState(const std::shared_ptr<VariableStateKVcache>& state, int idx);
 
+    // reads the KV cache states updated by another SDPA node instead of appending to them
+    bool isKVCacheReader() const {
+        return m_config.config.fuse_concat && m_config.config.kv_cache_reader;
+    }
+
     std::vector<size_t> getKVCacheOrder() const {
         const auto& permute_axes = m_config.config.permute_axes;
         std::vector<size_t> real_order = m_kvstate_layout;
@@ -74,6 +79,7 @@ public:
     const SDPAQuantParam& getValueQuantParam();
 
 private:
+    void initKVCacheQuantParams();
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -183,8 +184,64 @@ void Unique::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
 
+namespace {
+
+template <typename T>
+struct KeyIdx {
+    T val;
+    int32_t idx;
+
+    bool operator<(const KeyIdx& other) const {
+        return val < other.val || (val == other.val && idx < other.idx);
+    }
+};
+
+size_t getChunksNum(const CpuParallel& cpuParallel, size_t len) {
+    constexpr size_t minChunkLen = 4096LU;
+    return std::max<size_t>(1LU,
+                            std::min<size_t>(static_cast<size_t>(cpuParallel.get_num_threads()), len / minChunkLen));
+}
+
+// Sorts the chunks of the array in parallel and then merges them pairwise, each round of merges is also parallel.
+// Indices make all the keys distinct, so equal values are ordered by their position in the input.
+template <typename T>
+KeyIdx<T>* parallelSortByKey(const CpuParallel& cpuParallel,
+                             std::vector<KeyIdx<T>>& data,
+                             std::vector<KeyIdx<T>>& buf) {
+    const size_t len = data.size();
+    const size_t nChunks = getChunksNum(cpuParallel, len);
+    auto chunkBound = [&](size_t c) {
+        return c * len / nChunks;
+    };
+
+    KeyIdx<T>* src = data.data();
+    cpuParallel.parallel_for(nChunks, [&](size_t c) {
+        std::sort(src + chunkBound(c), src + chunkBound(c + 1));
+    });
+    if (nChunks == 1) {
+        return src;
+    }
+
+    buf.resize(len);
+    KeyIdx<T>* dst = buf.data();
+    for (size_t width = 1LU; width < nChunks; width *= 2) {
+        const size_t nMerges = (nChunks + 2 * width - 1) / (2 * width);
+        cpuParallel.parallel_for(nMerges, [&](size_t m) {
+            const size_t lo = chunkBound(2 * m * width);
+            const size_t mid = chunkBound(std::min(2 * m * width + width, nChunks));
+            const size_t hi = chunkBound(std::min(2 * m * width + 2 * width, nChunks));
+            std::merge(src + lo, src + mid, src + mid, src + hi, dst + lo);
+        });
+        std::swap(src, dst);
+    }
+    return src;
+}
+
+}  // namespace
+
 template <typename T>
 void Unique::flattenTensorExec() {
+    const auto& cpu_parallel = context->getCpuParallel();
     const T* srcDataPtr = getSrcDataAtPortAs<const T>(IN_DATA);
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
     std::vector<T> uniDataTmp(inputLen);
@@ -204,76 +261,83 @@ void Unique::flattenTensorExec() {
     uniqueLen = inputLen;
 
     if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto* last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
+        std::vector<KeyIdx<T>> keys(inputLen);
+        std::vector<KeyIdx<T>> keysBuf;
+        cpu_parallel->parallel_for(inputLen, [&](size_t i) {
+            keys[i] = {srcDataPtr[i], static_cast<int32_t>(i)};
+        });
+        const KeyIdx<T>* sortedKeys = parallelSortByKey(*cpu_parallel, keys, keysBuf);
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
+        // Run-length scan: each chunk counts the runs starting in it, and the exclusive prefix sum of the counts
+        // gives the unique index of the first run in the chunk.
+        const size_t nChunks = getChunksNum(*cpu_parallel, inputLen);
+        auto chunkBound = [&](size_t c) {
+            return c * inputLen / nChunks;
+        };
+        auto isRunStart = [&](size_t i) {
+            return i == 0 || sortedKeys[i - 1].val != sortedKeys[i].val;
+        };
+        std::vector<size_t> chunkRuns(nChunks + 1, 0LU);
+        cpu_parallel->parallel_for(nChunks, [&](size_t c) {
+            size_t runs = 0LU;
+            for (size_t i = chunkBound(c); i < chunkBound(c + 1); i++) {
+                runs += isRunStart(i) ? 1 : 0;
             }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
+            chunkRuns[c + 1] = runs;
+        });
+        std::partial_sum(chunkRuns.begin(), chunkRuns.end(), chunkRuns.begin());
+        uniqueLen = chunkRuns[nChunks];
+
+        // The first element of a run has the smallest input index among the equal values.
+        std::vector<size_t> runStart(uniqueLen + 1);
+        runStart[uniqueLen] = inputLen;
+        cpu_parallel->parallel_for(nChunks, [&](size_t c) {
+            size_t u = chunkRuns[c];  // index of the next run
+            for (size_t i = chunkBound(c); i < chunkBound(c + 1); i++) {
+                if (isRunStart(i)) {
+                    runStart[u] = i;
+                    uniDataTmpPtr[u] = sortedKeys[i].val;
+                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
+                        firstTmpPtr[u] = sortedKeys[i].idx;
                     }
+                    u++;
                 }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
+                if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+                    inToOutTmpPtr[sortedKeys[i].idx] = static_cast<int>(u - 1);
                 }
             }
+        });
+        if (definedOutputs[OCCURRENCES_NUM]) {
+            cpu_parallel->parallel_for(uniqueLen, [&](size_t u) {
+                occurTmpPtr[u] = static_cast<int>(runStart[u + 1] - runStart[u]);
+            });
         }
     } else {
+        // Unique values are kept in the order of their first occurrence.
         std::unordered_map<T, int32_t> uniq;
         uniq.reserve(inputLen);
 
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-
-        for (size_t i = 0, j = 0; i < inputLen; ++i) {
-            auto it = uniq.emplace(srcDataPtr[i], j);
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = it.first->second;
-                if (it.second) {
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        firstTmpPtr[j] = i;
-                    }
-                    ++j;
-                } else {
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        occurTmpPtr[inToOutTmpPtr[i]]++;
-                    }
+        for (size_t i = 0; i < inputLen; ++i) {
+            auto it = uniq.emplace(srcDataPtr[i], static_cast<int32_t>(uniq.size()));
+            const int32_t u = it.first->second;
+            if (it.second) {
+                uniDataTmpPtr[u] = srcDataPtr[i];
+                if (definedOutputs[FIRST_UNIQUE_IDX]) {
+                    firstTmpPtr[u] = static_cast<int>(i);
+                }
+                if (definedOutputs[OCCURRENCES_NUM]) {
+                    occurTmpPtr[u] = 0;
                 }
             }
+            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+                inToOutTmpPtr[i] = u;
+            }
+            if (definedOutputs[OCCURRENCES_NUM]) {
+                occurTmpPtr[u]++;
+            }
         }
 
-        uniqueLen = static_cast<int64_t>(uniq.size());
-        for (const auto& it : uniq) {
-            uniDataTmpPtr[it.second] = it.first;
-        }
+        uniqueLen = uniq.size();
     }
 
     redefineOutputMemory({{uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
@@ -138,6 +138,12 @@ public:
             }
         }
 
+        // the KV cache is owned by another node, only the attention output is produced
+        if (m_config.kv_cache_reader) {
+            output_dims[3] = present_v_dims[3];
+            return {{output_dims}, ShapeInferStatus::success};
+        }
+
         // normal and fast path
         if (present_v_dims[3] == query_dims[3]) {
             return {{output_dims, present_v_dims, present_v_dims}, ShapeInferStatus::success};
@@ -95,6 +95,9 @@ void ov::intel_cpu::ScaledDotProductAttentionWithKVCache::validate_and_infer_typ
         output_logits[output_logits.size() - 1] = past_v_ps[output_logits.size() - 1];
     }
     set_output_type(0, get_input_element_type(0), output_logits);
+    if (m_config.kv_cache_reader) {
+        return;
+    }
     set_output_type(1, get_input_element_type(input_num - 1), past_k_ps);
     set_output_type(2, get_input_element_type(input_num - 1), past_v_ps);
 }
@@ -107,6 +110,7 @@ bool ov::intel_cpu::ScaledDotProductAttentionWithKVCache::visit_attributes(ov::A
     visitor.on_attribute("is_causal", m_config.is_causal);
     visitor.on_attribute("fuse_concat", m_config.fuse_concat);
     visitor.on_attribute("permute_axes", m_config.permute_axes);
+    visitor.on_attribute("kv_cache_reader", m_config.kv_cache_reader);
     visitor.finish_structure();
     return true;
 }
@@ -34,6 +34,8 @@ public:
         std::vector<size_t> permute_axes;  // not empty means input has transpose. output of permutation is [B,H,L,S]
                                            // e.g. [L,B,H,S] -> permute[1, 2, 0, 3] ->[B, H, L, S]
         std::vector<size_t> order_HS;      // Reshape[B,L,H*S]->B,L,H,S], H,S are fixed value, when input_BLHxS is true.
+        bool kv_cache_reader = false;      // attend over KV cache updated by another (owner) node sharing the same
+                                           // states, e.g. cross-layer KV sharing. Only has the attention output
     };
 
     ScaledDotProductAttentionWithKVCache(const OutputVector& args, Config cfg);
@@ -11,6 +11,8 @@
 #include <cstdint>
 #include <memory>
 #include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "openvino/cc/pass/itt.hpp"
@@ -51,6 +53,30 @@ using namespace ov::pass;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// true if 'target' is reachable from 'node' through the inputs
+bool depends_on(const std::shared_ptr<ov::Node>& node, const ov::Node* target) {
+    std::vector<ov::Node*> stack{node.get()};
+    std::unordered_set<ov::Node*> visited;
+    while (!stack.empty()) {
+        auto* cur = stack.back();
+        stack.pop_back();
+        if (cur == target) {
+            return true;
+        }
+        if (!visited.insert(cur).second) {
+            continue;
+        }
+        for (const auto& input : cur->input_values()) {
+            stack.push_back(input.get_node());
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 StatefulSDPAFusion::StatefulSDPAFusion() {
     MATCHER_SCOPE(StatefulSDPAFusion);
     using namespace ov::pass::pattern;
@@ -161,8 +187,52 @@ StatefulSDPAFusion::StatefulSDPAFusion() {
         if (!check_valid_children_type(past_k_node) || !check_valid_children_type(past_v_node)) {
             return false;
         }
+
+        // SDPA of other layers attending over the same present k/v (cross-layer KV sharing) become readers of
+        // the KV cache states updated by this node, they must be executed after it.
+        std::vector<std::pair<std::shared_ptr<ov::op::v13::ScaledDotProductAttention>, ov::Output<ov::Node>>> readers;
+        std::unordered_set<ov::Node*> reader_nodes;
+        for (const auto& to : sdp_node->input_value(1).get_target_inputs()) {
+            auto reader = ov::as_type_ptr<ov::op::v13::ScaledDotProductAttention>(to.get_node()->shared_from_this());
+            if (!reader || reader == sdp_node || to.get_index() != 1 ||
+                reader->input_value(2) != sdp_node->input_value(2)) {
+                continue;
+            }
+            auto reader_q = reader->input_value(0);
+            if (pattern_map.count(order_q)) {
+                // the same transpose is folded into the reader
+                auto reader_transpose_q = ov::as_type_ptr<ov::op::v1::Transpose>(reader_q.get_node_shared_ptr());
+                if (!reader_transpose_q || reader_transpose_q->get_output_target_inputs(0).size() != 1) {
+                    return false;
+                }
+                auto reader_order_q =
+                    ov::as_type_ptr<ov::op::v0::Constant>(reader_transpose_q->get_input_node_shared_ptr(1));
+                const auto order_q_node =
+                    ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(order_q).get_node_shared_ptr());
+                if (!reader_order_q ||
+                    reader_order_q->cast_vector<int32_t>() != order_q_node->cast_vector<int32_t>()) {
+                    return false;
+                }
+                reader_q = reader_transpose_q->input_value(0);
+            }
+            if (!depends_on(reader_q.get_node_shared_ptr(), sdp_node.get())) {
+                return false;
+            }
+            readers.emplace_back(reader, reader_q);
+            reader_nodes.insert(reader.get());
+        }
+        auto get_consumers = [&reader_nodes](const ov::Output<ov::Node>& out) {
+            std::vector<ov::Input<ov::Node>> consumers;
+            for (const auto& to : out.get_target_inputs()) {
+                if (!reader_nodes.count(to.get_node())) {
+                    consumers.push_back(to);
+                }
+            }
+            return consumers;
+        };
+
         for (auto&& item : {concat_k_node, concat_v_node}) {
-            auto&& children = item->get_output_target_inputs(0);
+            auto children = get_consumers(item->output(0));
             switch (children.size()) {
             case 2:
                 // pass, as the existence of Assign will be checked later
@@ -200,11 +270,11 @@ StatefulSDPAFusion::StatefulSDPAFusion() {
             return false;
         }
 
-        auto is_optional_one_child = [&pattern_map](const std::vector<std::shared_ptr<Node>>& nodes) {
+        auto is_optional_one_child = [&pattern_map, &get_consumers](const std::vector<std::shared_ptr<Node>>& nodes) {
             return std::all_of(nodes.begin(), nodes.end(), [&](const std::shared_ptr<Node>& node) {
                 if (pattern_map.count(node)) {
                     auto p = pattern_map.at(node).get_node_shared_ptr();
-                    return p->get_output_target_inputs(0).size() == 1;
+                    return get_consumers(p->output(0)).size() == 1;
                 }
                 return true;
             });
@@ -276,6 +346,22 @@ StatefulSDPAFusion::StatefulSDPAFusion() {
         new_node->set_friendly_name(old_node->get_friendly_name());
         copy_runtime_info(old_node, new_node);
         ov::replace_node(old_node, {new_node->output(0)});
+
+        for (const auto& [reader, reader_q] : readers) {
+            OutputVector reader_args = reader->input_values();
+            reader_args[0] = reader_q;
+            reader_args[1] = args[1];
+            reader_args[2] = args[2];
+            reader_args.insert(reader_args.end(), args.end() - 3, args.end());
+            auto reader_config = config;
+            reader_config.is_causal = reader->get_causal();
+            reader_config.kv_cache_reader = true;
+            auto new_reader =
+                std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(reader_args, reader_config);
+            new_reader->set_friendly_name(reader->get_friendly_name());
+            copy_runtime_info(reader, new_reader);
+            ov::replace_node(reader, {new_reader->output(0)});
+        }
         if (assign_cvt_k_node) {
             assign_cvt_k_node->set_arguments({new_node->output(1)});
         } else {
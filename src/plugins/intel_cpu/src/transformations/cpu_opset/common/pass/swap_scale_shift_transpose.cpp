@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "swap_scale_shift_transpose.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+namespace {
+
+bool is_scale_shift(const std::shared_ptr<ov::Node>& node) {
+    if (!ov::is_type_any_of<ov::op::v1::Subtract, ov::op::v1::Multiply, ov::op::v1::Add, ov::op::v1::Divide>(node)) {
+        return false;
+    }
+    const auto& broadcast = node->get_autob();
+    return broadcast.m_type == ov::op::AutoBroadcastType::NUMPY &&
+           ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1)) &&
+           node->get_output_target_inputs(0).size() == 1;
+}
+
+// The chain of scale/shift operations must start at a u8 model input converted to a floating point type
+bool starts_at_u8_input(const ov::Output<ov::Node>& output) {
+    auto node = output.get_node_shared_ptr();
+    while (is_scale_shift(node)) {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    if (!ov::is_type<ov::op::v0::Convert>(node) || node->get_output_target_inputs(0).size() != 1) {
+        return false;
+    }
+    const auto input = node->get_input_node_shared_ptr(0);
+    return ov::is_type<ov::op::v0::Parameter>(input) && input->get_output_element_type(0) == ov::element::u8;
+}
+
+}  // namespace
+
+ov::intel_cpu::SwapScaleShiftTranspose::SwapScaleShiftTranspose() {
+    MATCHER_SCOPE(SwapScaleShiftTranspose);
+    auto scale_shift_m =
+        ov::pass::pattern::wrap_type<ov::op::v1::Subtract, ov::op::v1::Multiply, ov::op::v1::Add, ov::op::v1::Divide>(
+            {ov::pass::pattern::any_input(ov::pass::pattern::has_static_rank()),
+             ov::pass::pattern::wrap_type<ov::op::v0::Constant>()},
+            ov::pass::pattern::consumers_count(1) && starts_at_u8_input);
+    auto order_m = ov::pass::pattern::wrap_type<ov::op::v0::Constant>();
+    auto transpose_m = ov::pass::pattern::wrap_type<ov::op::v1::Transpose>({scale_shift_m, order_m});
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        // Swap
+        // Input -> ... -> [N,H,W,C] -> Subtract/Multiply(const[1,1,1,C]) -> Transpose -> [N,C,H,W]
+        // to
+        // Input -> ... -> [N,H,W,C] -> Transpose -> Subtract/Multiply(const[1,C,1,1]) -> [N,C,H,W]
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto scale_shift = pattern_map.at(scale_shift_m).get_node_shared_ptr();
+        auto transpose = pattern_map.at(transpose_m).get_node_shared_ptr();
+        auto order = ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(order_m).get_node_shared_ptr());
+
+        if (!is_scale_shift(scale_shift)) {
+            return false;
+        }
+
+        const auto rank = scale_shift->get_output_partial_shape(0).size();
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(scale_shift->get_input_node_shared_ptr(1));
+        const auto& const_shape = constant->get_shape();
+        if (const_shape.size() > rank || order->get_shape() != ov::Shape{rank}) {
+            return false;
+        }
+        // Align the constant rank with the data rank so it can be permuted with the same order
+        ov::Shape aligned_shape(rank - const_shape.size(), 1);
+        aligned_shape.insert(aligned_shape.end(), const_shape.begin(), const_shape.end());
+        auto aligned_constant = std::make_shared<ov::op::v0::Constant>(*constant, aligned_shape);
+        auto permuted_constant =
+            ov::util::get_constant_from_source(std::make_shared<ov::op::v1::Transpose>(aligned_constant, order));
+        if (!permuted_constant) {
+            return false;
+        }
+
+        auto newTranspose = transpose->clone_with_new_inputs({scale_shift->input_value(0), order});
+        newTranspose->set_friendly_name(transpose->get_friendly_name() + "_original");
+
+        auto newScaleShift = scale_shift->clone_with_new_inputs({newTranspose, permuted_constant});
+        ov::replace_node(transpose, newScaleShift);
+        newScaleShift->set_friendly_name(transpose->get_friendly_name());
+
+        ov::copy_runtime_info({scale_shift, transpose}, {newTranspose, newScaleShift, permuted_constant});
+        register_new_node(newTranspose);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(transpose_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Moves a layout Transpose above the per-channel scale/shift operations which follow a converted u8 model
+ * input, e.g. Parameter(u8) -> Convert -> Subtract(mean) -> Multiply(scale) -> Transpose produced by PrePostProcessor.
+ * Together with SwapConvertTranspose the Transpose ends up right after the Parameter, where it is merged with
+ * the input reorder, while Convert and the scale/shift operations are fused into a single Eltwise node.
+ */
+class SwapScaleShiftTranspose : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("SwapScaleShiftTranspose");
+    SwapScaleShiftTranspose();
+};
+
+}  // namespace ov::intel_cpu
@@ -26,6 +26,11 @@ public:
         int proj_size1;
         int proj_size2;
         bool weights_combined;
+        // rotate-half RoPE fused into Q & K projections (disabled when 0), cos/sin tables are appended as
+        // the last two inputs and outputs 0 & 1 are produced in [B, H, L, rope_head_size] layout
+        int rope_rotary_ndims = 0;
+        int rope_head_size = 0;
+        int rope_cos_sin_ndims = 0;
     };
 
     QKVProjectionNode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
@@ -19,6 +19,7 @@
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/op/variadic_split.hpp"
 #include "openvino/pass/matcher_pass.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
@@ -27,6 +28,7 @@
 #include "openvino/pass/pattern/op/pattern.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/pp.hpp"
+#include "ov_ops/rotary_positional_embeddings.hpp"
 #include "transformations/cpu_opset/x64/op/qkv_proj.hpp"
 #include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
 
@@ -295,6 +297,124 @@ ov::intel_cpu::QKVProjFusionPass2::QKVProjFusionPass2() {
     this->register_matcher(m, callback);
 }
 
+ov::intel_cpu::QKVProjRoPEFusion::QKVProjRoPEFusion() {
+    MATCHER_SCOPE(QKVProjRoPEFusion);
+
+    auto qkv_proj = pattern::wrap_type<QKVProjectionNode>();
+    auto q_reshape = pattern::wrap_type<v1::Reshape>({qkv_proj, pattern::wrap_const()}, pattern::rank_equals(4));
+    auto cos_tab = pattern::any_input(pattern::type_matches(element::f32));
+    auto sin_tab = pattern::any_input(pattern::type_matches(element::f32));
+    auto q_rope = pattern::wrap_type<ov::op::internal::RoPE>({q_reshape, cos_tab, sin_tab});
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto qkv_out = pattern_map.at(qkv_proj);
+        auto qkv_node = ov::as_type_ptr<QKVProjectionNode>(qkv_out.get_node_shared_ptr());
+        // the match is anchored on Q, K is looked up from the 2nd output
+        if (!qkv_node || qkv_out.get_index() != 0) {
+            return false;
+        }
+        auto qkv_config = qkv_node->get_config();
+        if (qkv_config.rope_rotary_ndims > 0) {
+            return false;
+        }
+
+        // Reshape([B, L, H*S] => [B, L, H, S]) -> RoPE(input_trans0213) produces [B, H, L, S]
+        auto get_rope = [](const ov::Output<ov::Node>& out, int proj_size) -> std::shared_ptr<ov::op::internal::RoPE> {
+            const auto& out_consumers = out.get_target_inputs();
+            if (out_consumers.size() != 1) {
+                return nullptr;
+            }
+            auto reshape = ov::as_type_ptr<v1::Reshape>(out_consumers.begin()->get_node()->shared_from_this());
+            if (!reshape || !reshape->get_special_zero()) {
+                return nullptr;
+            }
+            auto target_shape = ov::as_type_ptr<v0::Constant>(reshape->get_input_node_shared_ptr(1));
+            if (!target_shape) {
+                return nullptr;
+            }
+            const auto target = target_shape->cast_vector<int64_t>();
+            if (target.size() != 4 || target[0] != 0 || target[1] != 0 || target[2] <= 0 || target[3] <= 0 ||
+                target[2] * target[3] != proj_size) {
+                return nullptr;
+            }
+            const auto& reshape_consumers = reshape->get_output_target_inputs(0);
+            if (reshape_consumers.size() != 1 || reshape_consumers.begin()->get_index() != 0) {
+                return nullptr;
+            }
+            auto rope =
+                ov::as_type_ptr<ov::op::internal::RoPE>(reshape_consumers.begin()->get_node()->shared_from_this());
+            if (!rope || rope->get_input_size() != 3) {
+                return nullptr;
+            }
+            const auto& config = rope->get_config();
+            if (config.is_interleaved || config.is_chatglm || config.is_qwen || config.support_2d_rope ||
+                config.support_3d_rope || config.is_ltx_video || config.use_rope_cache ||
+                config.gather_position_arg_id != 0 || config.slice_stop - config.slice_start > 0 ||
+                !config.input_trans0213 || config.output_trans0213) {
+                return nullptr;
+            }
+            if (config.rotary_ndims == 0 || (config.rotary_ndims % 2) != 0 ||
+                config.rotary_ndims > static_cast<size_t>(target[3])) {
+                return nullptr;
+            }
+            return rope;
+        };
+
+        auto rope_q = get_rope(qkv_node->output(0), qkv_config.proj_size0);
+        auto rope_k = get_rope(qkv_node->output(1), qkv_config.proj_size1);
+        if (!rope_q || !rope_k) {
+            return false;
+        }
+        const auto& config_q = rope_q->get_config();
+        const auto& config_k = rope_k->get_config();
+        if (config_q.rotary_ndims != config_k.rotary_ndims || config_q.cos_sin_ndims != config_k.cos_sin_ndims ||
+            rope_q->input_value(1) != rope_k->input_value(1) || rope_q->input_value(2) != rope_k->input_value(2)) {
+            return false;
+        }
+        const auto head_size = rope_q->get_input_partial_shape(0)[3];
+        if (head_size.is_dynamic() || head_size != rope_k->get_input_partial_shape(0)[3]) {
+            return false;
+        }
+
+        // cos/sin tables must be shared by all heads: [?, 1, L, D], [1, L, D] or [L, D]
+        for (size_t i = 1; i < 3; i++) {
+            const auto& tab_shape = rope_q->get_input_partial_shape(i);
+            if (tab_shape.rank().is_dynamic() || tab_shape.size() < 2 || tab_shape.size() > 4) {
+                return false;
+            }
+            if (tab_shape.size() > 2 && tab_shape[tab_shape.size() - 3] != 1) {
+                return false;
+            }
+        }
+
+        qkv_config.rope_rotary_ndims = static_cast<int>(config_q.rotary_ndims);
+        qkv_config.rope_head_size = static_cast<int>(head_size.get_length());
+        qkv_config.rope_cos_sin_ndims = static_cast<int>(config_q.cos_sin_ndims);
+
+        auto args = qkv_node->input_values();
+        args.push_back(rope_q->input_value(1));
+        args.push_back(rope_q->input_value(2));
+
+        auto new_node = std::make_shared<QKVProjectionNode>(args, qkv_config);
+        new_node->set_friendly_name(qkv_node->get_friendly_name());
+        ov::copy_runtime_info({qkv_node, rope_q, rope_k}, new_node);
+
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        rope_q->output(0).replace(new_node->output(0));
+        rope_k->output(0).replace(new_node->output(1));
+        qkv_node->output(2).replace(new_node->output(2));
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(q_rope, matcher_name);
+    this->register_matcher(m, callback);
+}
+
 bool ov::intel_cpu::QKVProjFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(QKVProjFusion);
 
@@ -303,6 +423,7 @@ bool ov::intel_cpu::QKVProjFusion::run_on_model(const std::shared_ptr<ov::Model>
 
     symbolic_ctx_manager->register_pass<QKVProjFusionPass1>();
     symbolic_ctx_manager->register_pass<QKVProjFusionPass2>();
+    symbolic_ctx_manager->register_pass<QKVProjRoPEFusion>();
 
     return symbolic_optimizations.run_on_model(model);
 }
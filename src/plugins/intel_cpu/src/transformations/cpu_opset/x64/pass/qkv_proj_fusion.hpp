@@ -20,6 +20,14 @@ public:
     QKVProjFusionPass2();
 };
 
+// Folds the rotate-half RoPE applied on Q & K outputs of QKVProjection (through Reshape to [B, L, H, S])
+// into the projection, which then produces rotated Q & K directly in [B, H, L, S] layout.
+class QKVProjRoPEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("QKVProjRoPEFusion");
+    QKVProjRoPEFusion();
+};
+
 class QKVProjFusion : public ov::pass::ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("QKVProjFusion");
@@ -145,6 +145,7 @@
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/swap_scale_shift_transpose.hpp"
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
 #include "utils/precision_support.h"
 
@@ -681,6 +682,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
 
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EliminateConvert);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EliminateIdentityConvert);
+    // Preprocessing steps of a model input: move the layout Transpose to the input, so Convert and the mean/scale
+    // operations are executed as one Eltwise reading the user buffer, and the Transpose is merged with its reorder
+    CPU_REGISTER_PASS_COMMON(manager, SwapScaleShiftTranspose);
     CPU_REGISTER_PASS_COMMON(manager, SwapConvertTranspose);
     CPU_REGISTER_PASS_X64(manager, ConvertToInteraction);
     CPU_REGISTER_PASS_X64(manager, ConvertInteractionInt8);
@@ -913,7 +917,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion, true);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
     manager.run_passes(model);
@@ -1135,6 +1139,11 @@ void Transformations::PostLpt() {
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionLtxVideo);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
 
+    // markup Rope Input when BF16/F16 inference, before RoPE may be fused into QKVProjection.
+    if (any_of(config.inferencePrecision, ov::element::bf16, ov::element::f16)) {
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkRopeInputsToKeepInMixedPrecision);
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
     auto can_use_amx_bf16_int8 = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
@@ -1180,6 +1189,17 @@ void Transformations::PostLpt() {
                                                                  fcDynamicQuantizationGroupSize);
             },
             QKVProjFusionPass2);
+
+        CPU_SET_CALLBACK_X64(
+            postLPTPassManager,
+            [=](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::QKVProjection::isSupportedOperation(node,
+                                                                 errorMsg,
+                                                                 concurrency,
+                                                                 fcDynamicQuantizationGroupSize);
+            },
+            QKVProjRoPEFusion);
     }
 #endif  // OPENVINO_ARCH_X86_64
 
@@ -1193,9 +1213,7 @@ void Transformations::PostLpt() {
         },
         ov::intel_cpu::DecomposeRMSNorm);
 
-    // markup Rope Input when BF16/F16 inference.
     if (any_of(config.inferencePrecision, ov::element::bf16, ov::element::f16)) {
-        CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkRopeInputsToKeepInMixedPrecision);
         CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkFloatingPointRange);
     }
 
@@ -719,7 +719,15 @@ std::ostream& operator<<(std::ostream& os, const MemoryStatisticsRecord& record)
     os << "Total unique blocks: " << record.total_unique_blocks << "\n";
     os << "Total size: " << record.total_size << " bytes\n";
     os << "Optimal total size: " << record.optimal_total_size << " bytes\n";
+    if (record.total_size > 0) {
+        os << "Fragmentation: "
+           << 1.0 - static_cast<double>(record.optimal_total_size) / static_cast<double>(record.total_size) << "\n";
+    }
     os << "Max region size: " << record.max_region_size << " bytes\n";
+    for (auto&& [node, bytes] : record.numa_node_bytes) {
+        os << "NUMA node " << node << " resident size: " << bytes << " bytes\n";
+    }
+    os << "Huge pages backed size: " << record.huge_page_bytes << " bytes\n";
     return os;
 }
 
@@ -54,6 +54,10 @@ static void dumpStatistics(std::ostream& os,
         os << "Socket ID: " << item.first << "\n";
         os << "Total size: " << item.second.total_size << " bytes\n";
         os << "Total memory objects: " << item.second.total_memory_objects << "\n";
+        for (auto&& [node, bytes] : item.second.numa_node_bytes) {
+            os << "NUMA node " << node << " resident size: " << bytes << " bytes\n";
+        }
+        os << "Huge pages backed size: " << item.second.huge_page_bytes << " bytes\n";
     }
 }
 
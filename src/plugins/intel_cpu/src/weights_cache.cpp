@@ -60,6 +60,14 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
         if (!isCached()) {
             newPtr = create();
+            if (newPtr && newPtr->getSize() > 0) {
+                if (m_interleave) {
+                    mbind_interleave(newPtr->getData(), newPtr->getSize());
+                }
+                if (m_hugePages) {
+                    madvise_huge_pages(newPtr->getData(), newPtr->getSize());
+                }
+            }
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -91,10 +99,13 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+SocketsWeights::SocketsWeights(bool interleave, bool hugePages) {
     int num_sockets = get_num_sockets();
+    // with several sockets every socket keeps its own copy of the weights, interleaving a copy across the nodes of
+    // all the sockets would only add remote accesses
+    interleave = interleave && num_sockets == 1;
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] = std::make_shared<WeightsSharing>(interleave, hugePages);
     }
 }
 
@@ -112,7 +123,7 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
 
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal = {0, 0, {}, 0};
 
     std::lock_guard<std::mutex> lock(guard);
 
@@ -121,6 +132,10 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
         if (memory) {
             retVal.total_size += memory->getDesc().getCurrentMemSize();
             retVal.total_memory_objects++;
+            for (auto&& [node, bytes] : numa_resident_bytes(memory->getData(), memory->getSize())) {
+                retVal.numa_node_bytes[node] += bytes;
+            }
+            retVal.huge_page_bytes += huge_page_resident_bytes(memory->getData(), memory->getSize());
         }
     }
 
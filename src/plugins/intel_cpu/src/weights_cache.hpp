@@ -46,11 +46,21 @@ public:
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
+        std::map<int, size_t> numa_node_bytes;  // resident bytes per NUMA node
+        size_t huge_page_bytes;                 // bytes backed by huge pages
     };
 #endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    /**
+     * @param interleave - whether the newly created entries are interleaved across all NUMA nodes
+     * @param hugePages - whether the newly created entries are advised to be backed by huge pages
+     */
+    explicit WeightsSharing(bool interleave = false, bool hugePages = false)
+        : m_interleave(interleave),
+          m_hugePages(hugePages) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,6 +83,10 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    [[nodiscard]] bool isInterleaved() const {
+        return m_interleave;
+    }
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,6 +94,8 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    bool m_interleave = false;
+    bool m_hugePages = false;
 };
 
 /**
@@ -89,7 +105,7 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    explicit SocketsWeights(bool interleave = false, bool hugePages = false);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
@@ -55,7 +55,10 @@ public:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex, reduction] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeSelectedTypeStr("ref", deduce_expected_precision(inType, configuration));
+        if (inType == ElementType::bf16 || inType == ElementType::f16) {
+            rel_threshold = 1e-2f;
+        }
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -85,7 +88,8 @@ TEST_P(EmbeddingBagOffsetsLayerCPUTest, CompareWithRefs) {
 
 namespace {
 
-const std::vector<ElementType> netPrecisions = {ElementType::f32, ElementType::i32, ElementType::u8};
+const std::vector<ElementType> netPrecisions =
+    {ElementType::f32, ElementType::bf16, ElementType::f16, ElementType::i32, ElementType::u8};
 
 const std::vector<ElementType> indPrecisions = {ElementType::i64, ElementType::i32};
 
@@ -115,6 +115,66 @@ const auto params_dynamic_log = ::testing::Combine(test_type_dynamic,
                                                    global_op_seed,
                                                    device_cpu);
 
+// The probabilities are integers summing to a power of two in each row: the cdf and the scaled samples are exact in
+// both the plugin and the reference, so the classes drawn for the fixed seeds follow the reference Philox sequence.
+std::vector<float> probs_2x16_f32_seq = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 1.0f, 1.0f,
+                                         1.0f, 2.0f, 2.0f, 2.0f, 6.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f,
+                                         4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 2.0f};
+
+std::vector<ov::float16> probs_1x16_f16_seq = [] {
+    std::vector<ov::float16> probs(16);
+    for (size_t i = 0; i < probs.size(); i++) {
+        probs[i] = ov::float16(static_cast<float>(1 + i % 7));
+    }
+    // 64 in total
+    probs[15] = ov::float16(7.0f);
+    return probs;
+}();
+
+// a single row of a large vocabulary is scanned in parallel chunks
+std::vector<float> probs_1x16384_f32_seq = [] {
+    std::vector<float> probs(16384);
+    for (size_t i = 0; i < probs.size(); i++) {
+        probs[i] = i % 4 == 0 ? 5.0f : 1.0f;
+    }
+    return probs;
+}();
+
+std::vector<int> num_samples_scalar_i32_seq = {256};
+std::vector<int> num_samples_scalar_i32_seq_no_replace = {4};
+
+const auto probs_seq = testing::Values(ov::Tensor(ov::element::f32, {2, 16}, probs_2x16_f32_seq.data()),
+                                       ov::Tensor(ov::element::f16, {1, 16}, probs_1x16_f16_seq.data()),
+                                       ov::Tensor(ov::element::f32, {1, 16384}, probs_1x16384_f32_seq.data()));
+
+// the cdf is renormalized by a division in the reference after a class is drawn, which is exact enough only in f32
+const auto probs_seq_f32 = testing::Values(ov::Tensor(ov::element::f32, {2, 16}, probs_2x16_f32_seq.data()),
+                                           ov::Tensor(ov::element::f32, {1, 16384}, probs_1x16384_f32_seq.data()));
+
+const auto fixed_seeds =
+    testing::Values(std::pair<uint64_t, uint64_t>{1ul, 2ul}, std::pair<uint64_t, uint64_t>{42ul, 7ul});
+
+const auto params_fixed_seed = ::testing::Combine(test_type_static,
+                                                  probs_seq,
+                                                  testing::Values(ov::Tensor(ov::element::i32,
+                                                                             {},
+                                                                             num_samples_scalar_i32_seq.data())),
+                                                  testing::Values(ov::test::ElementType::i32),
+                                                  testing::Values(true),
+                                                  log_probs_false,
+                                                  fixed_seeds,
+                                                  device_cpu);
+
+const auto params_fixed_seed_no_replace =
+    ::testing::Combine(test_type_static,
+                       probs_seq_f32,
+                       testing::Values(ov::Tensor(ov::element::i32, {}, num_samples_scalar_i32_seq_no_replace.data())),
+                       testing::Values(ov::test::ElementType::i64),
+                       testing::Values(false),
+                       log_probs_false,
+                       fixed_seeds,
+                       device_cpu);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MultinomialStatic,
                          MultinomialLayerTest,
                          params_static,
@@ -134,4 +194,14 @@ INSTANTIATE_TEST_SUITE_P(smoke_MultinomialDynamicLog,
                          MultinomialLayerTest,
                          params_dynamic_log,
                          MultinomialLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MultinomialFixedSeed,
+                         MultinomialLayerTest,
+                         params_fixed_seed,
+                         MultinomialLayerTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MultinomialFixedSeedNoReplace,
+                         MultinomialLayerTest,
+                         params_fixed_seed_no_replace,
+                         MultinomialLayerTest::getTestCaseName);
 }  // namespace
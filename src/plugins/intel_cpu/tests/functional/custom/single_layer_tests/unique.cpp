@@ -127,6 +127,26 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+// The flattened mode splits big inputs into chunks, which are sorted and scanned in parallel. A narrow range of values
+// makes runs of equal values cross the chunk boundaries.
+class UniqueLayerTestCPUParallel : public UniqueLayerTestCPU {
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs().front();
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -50;
+        in_data.range = 100;
+        auto tensor = utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[0], in_data);
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(UniqueLayerTestCPUParallel, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "Unique");
+}
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {ElementType::f32, ElementType::i32};
@@ -263,6 +283,23 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic,
                                             ::testing::ValuesIn(getCPUInfo()),
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> parallelShapes = {
+    {{{}, {{100003}}}},                               // Static shapes
+    {{{}, {{64, 33, 17}}}},                           // Static shapes
+    {{{-1, -1},                                       // Dynamic shape
+      {{3, 3001}, {70, 1001}, {1, 5}, {2, 4097}}}}    // Target shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_parallel,
+                         UniqueLayerTestCPUParallel,
+                         ::testing::Combine(::testing::ValuesIn(parallelShapes),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
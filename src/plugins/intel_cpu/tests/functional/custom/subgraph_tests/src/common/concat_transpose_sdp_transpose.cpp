@@ -388,6 +388,35 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTest,
                          ConcatSDPTransposeTest::getTestCaseName);
 }  //  namespace
 
+// The KV cache states are created before the first inference, while with the lazy weights activation the SDPA
+// primitive is created only at the first inference, so the states must get the same quantization parameters.
+class ConcatSDPTransposeTestLazyWeights : public ConcatSDPTransposeTest {};
+
+TEST_P(ConcatSDPTransposeTestLazyWeights, CompareWithEagerActivation) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    configuration[ov::hint::kv_cache_precision.name()] = ov::element::u8;
+    configuration[ov::intel_cpu::lazy_weights.name()] = false;
+    auto expectedOutputs = run_test(function);
+    configuration[ov::intel_cpu::lazy_weights.name()] = true;
+    auto actualOutputs = run_test(function);
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+    ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], 0.0f, 0.0f);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeLazyWeightsTest,
+                         ConcatSDPTransposeTestLazyWeights,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+}  //  namespace
+
 class ConcatSDPTransposeTestSetState : public ConcatSDPTransposeTestBase {
 public:
     void reduce_state() {
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <new>
+#include <numeric>
+#include <vector>
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+/*
+  The output of a dynamic model is set as a tensor which owns its memory through a user allocator.
+  The graph must write the output directly into that tensor, growing it with the user allocator when needed.
+*/
+namespace {
+struct CountingAllocator {
+    size_t* allocations;
+    void** last_ptr;
+
+    void* allocate(const size_t bytes, const size_t alignment) {
+        ++(*allocations);
+        *last_ptr = ::operator new(bytes, std::align_val_t(alignment));
+        return *last_ptr;
+    }
+
+    void deallocate(void* handle, const size_t /*bytes*/, size_t alignment) noexcept {
+        ::operator delete(handle, std::align_val_t(alignment));
+    }
+
+    bool is_equal(const CountingAllocator& other) const noexcept {
+        return allocations == other.allocations;
+    }
+};
+}  // namespace
+
+TEST(DynamicOutputUserAllocator, smoke_WriteDirectlyIntoUserTensor) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, -1});
+    auto shift = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1}, {1.0f});
+    auto add = std::make_shared<ov::op::v1::Add>(param, shift);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiled_model = core.compile_model(model, "CPU");
+    auto infer_request = compiled_model.create_infer_request();
+
+    size_t allocations = 0;
+    void* last_ptr = nullptr;
+    ov::Tensor output(ov::element::f32, ov::Shape{1, 0}, ov::Allocator(CountingAllocator{&allocations, &last_ptr}));
+    infer_request.set_output_tensor(output);
+
+    for (size_t len : {16, 64, 8, 64, 256}) {
+        std::vector<float> input_data(len);
+        std::iota(input_data.begin(), input_data.end(), 0.0f);
+        infer_request.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{1, len}, input_data.data()));
+        const auto allocations_before = allocations;
+        infer_request.infer();
+
+        auto result = infer_request.get_output_tensor();
+        ASSERT_EQ(result.get_shape(), (ov::Shape{1, len}));
+        ASSERT_EQ(result.data(), output.data());
+        ASSERT_EQ(result.data(), last_ptr);
+        // the tensor is only reallocated when the output grows beyond its capacity
+        ASSERT_LE(allocations - allocations_before, 1u);
+        const auto* data = result.data<const float>();
+        for (size_t i = 0; i < len; ++i) {
+            ASSERT_EQ(data[i], input_data[i] + 1.0f);
+        }
+    }
+}
+
+}  // namespace test
+}  // namespace ov
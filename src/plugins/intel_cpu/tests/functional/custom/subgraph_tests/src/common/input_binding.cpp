@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/* Checks how Graph::PushInputData binds the user input tensor:
+ *  - a dense tensor is read directly by the graph, there is no Reorder or Convert of the input in the runtime model,
+ *  - a strided ROI tensor is reordered into the graph memory.
+ * The binding is updated when the tensors of the next inference differ, and the writes to the user buffer between
+ * the inferences are seen by the graph.
+ */
+class InputBindingTest : public ::testing::TestWithParam<ov::PartialShape> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<ov::PartialShape>& obj) {
+        std::ostringstream result;
+        result << "shape=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> create_test_function(const ov::PartialShape& shape) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, shape);
+        param->set_friendly_name("input_0");
+        param->get_output_tensor(0).set_names({"tensor_input_0"});
+
+        auto constant = ov::op::v0::Constant::create(element::f32, {1}, {1});
+        auto add = std::make_shared<ov::op::v1::Add>(param, constant);
+        add->set_friendly_name("Add");
+
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        result->set_friendly_name("result_0");
+        result->get_output_tensor(0).set_names({"tensor_output_0"});
+
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    static void check_output(const ov::InferRequest& req, const std::vector<float>& expected) {
+        auto actual_tensor = req.get_tensor("tensor_output_0");
+        ASSERT_EQ(actual_tensor.get_size(), expected.size());
+        const auto* actual = actual_tensor.data<float>();
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(actual[i], expected[i]) << "at " << i;
+        }
+    }
+};
+
+TEST_P(InputBindingTest, BindsUserTensor) {
+    std::shared_ptr<ov::Core> core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(GetParam()), "CPU");
+    // the Add reads the graph input directly, so a dense user tensor is not copied
+    CheckNumberOfNodesWithType(compiled_model, "Reorder", 0);
+    CheckNumberOfNodesWithType(compiled_model, "Convert", 0);
+    ov::InferRequest req = compiled_model.create_infer_request();
+
+    const ov::Shape shape{1, 2, 2, 2};
+    std::vector<float> data(ov::shape_size(shape));
+    std::iota(data.begin(), data.end(), 0.0f);
+    std::vector<float> expected(data.size());
+    std::transform(data.begin(), data.end(), expected.begin(), [](float value) {
+        return value + 1.0f;
+    });
+    auto dense_tensor = ov::Tensor(element::f32, shape, data.data());
+
+    // dense user tensor: the graph reads the user memory directly
+    req.set_tensor("tensor_input_0", dense_tensor);
+    req.infer();
+    check_output(req, expected);
+
+    // strided ROI tensor of the same shape: the data is reordered into the graph memory
+    std::vector<float> parent_data(ov::shape_size(ov::Shape{1, 4, 4, 4}));
+    std::iota(parent_data.begin(), parent_data.end(), 0.0f);
+    auto parent_tensor = ov::Tensor(element::f32, ov::Shape{1, 4, 4, 4}, parent_data.data());
+    auto roi_tensor = ov::Tensor(parent_tensor, {0, 1, 1, 1}, {1, 3, 3, 3});
+    req.set_tensor("tensor_input_0", roi_tensor);
+    req.infer();
+    check_output(req, {22, 23, 26, 27, 38, 39, 42, 43});
+
+    // back to the dense tensor, the binding is updated and the graph reads the current content of the user buffer
+    req.set_tensor("tensor_input_0", dense_tensor);
+    std::fill(data.begin(), data.end(), 5.0f);
+    req.infer();
+    check_output(req, std::vector<float>(data.size(), 6.0f));
+
+    // the next write to the same user buffer is seen by the next inference
+    std::fill(data.begin(), data.end(), -1.0f);
+    req.infer();
+    check_output(req, std::vector<float>(data.size(), 0.0f));
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_InputBinding,
+                         InputBindingTest,
+                         ::testing::Values(ov::PartialShape{1, 2, 2, 2},
+                                           ov::PartialShape{1, 2, ov::Dimension::dynamic(), ov::Dimension::dynamic()}),
+                         InputBindingTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+namespace ov {
+namespace test {
+
+using LazyWeightsParams = std::tuple<ov::PartialShape,                   // input shape
+                                     std::vector<ov::Shape>,             // shapes of the consecutive inferences
+                                     std::map<std::string, std::string>  // additional config
+                                     >;
+
+/* With CPU_LAZY_WEIGHTS the primitives are created and the constant nodes are executed by the first inference, each
+ * node right before it is executed. Compares the lazily activated model with the eagerly activated one, also when the
+ * inference goes through the sub streams of the tensor parallel mode.
+ */
+class LazyWeightsTest : public ::testing::TestWithParam<LazyWeightsParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<LazyWeightsParams>& obj) {
+        const auto& [inputShape, targetShapes, config] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_TS=";
+        for (const auto& shape : targetShapes) {
+            result << "(" << shape << ")_";
+        }
+        for (const auto& [key, value] : config) {
+            result << key << "=" << value << "_";
+        }
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> create_test_function(const ov::PartialShape& shape) {
+        const size_t K = shape[shape.size() - 1].get_length();
+        const size_t N = 64;
+        auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, shape);
+        auto weights0 = ov::test::utils::make_constant(element::f32, ov::Shape{K, N});
+        auto matmul0 = std::make_shared<ov::op::v0::MatMul>(param, weights0);
+        auto bias = ov::test::utils::make_constant(element::f32, ov::Shape{N});
+        auto add = std::make_shared<ov::op::v1::Add>(matmul0, bias);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        auto weights1 = ov::test::utils::make_constant(element::f32, ov::Shape{N, K});
+        auto matmul1 = std::make_shared<ov::op::v0::MatMul>(relu, weights1);
+        return std::make_shared<ov::Model>(ResultVector{std::make_shared<ov::op::v0::Result>(matmul1)},
+                                           ParameterVector{param});
+    }
+
+    static std::vector<ov::Tensor> infer(const ov::CompiledModel& compiled_model,
+                                         const std::vector<ov::Tensor>& inputs) {
+        auto req = compiled_model.create_infer_request();
+        std::vector<ov::Tensor> outputs;
+        for (const auto& input : inputs) {
+            req.set_input_tensor(input);
+            req.infer();
+            const auto& output = req.get_output_tensor();
+            ov::Tensor copy{output.get_element_type(), output.get_shape()};
+            output.copy_to(copy);
+            outputs.push_back(copy);
+        }
+        return outputs;
+    }
+};
+
+TEST_P(LazyWeightsTest, CompareWithEagerActivation) {
+    const auto& [inputShape, targetShapes, config] = GetParam();
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto model = create_test_function(inputShape);
+
+    std::vector<ov::Tensor> inputs;
+    for (const auto& shape : targetShapes) {
+        inputs.push_back(ov::test::utils::create_and_fill_tensor(element::f32, shape));
+    }
+
+    ov::AnyMap eager_config(config.begin(), config.end());
+    eager_config[ov::intel_cpu::lazy_weights.name()] = false;
+    const auto expected = infer(core->compile_model(model, "CPU", eager_config), inputs);
+
+    ov::AnyMap lazy_config(config.begin(), config.end());
+    lazy_config[ov::intel_cpu::lazy_weights.name()] = true;
+    const auto actual = infer(core->compile_model(model, "CPU", lazy_config), inputs);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        ov::test::utils::compare(expected[i], actual[i], 0.0f, 0.0f);
+    }
+}
+
+namespace {
+
+const std::map<std::string, std::string> default_config = {};
+
+const std::map<std::string, std::string> model_distribution_config = {
+    {ov::hint::model_distribution_policy.name(), "TENSOR_PARALLEL"},
+    {ov::intel_cpu::enable_tensor_parallel.name(), "true"},
+    {ov::num_streams.name(), "1"}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LazyWeightsStatic,
+                         LazyWeightsTest,
+                         ::testing::Combine(::testing::Values(ov::PartialShape{2, 96}),
+                                            ::testing::Values(std::vector<ov::Shape>{{2, 96}, {2, 96}}),
+                                            ::testing::Values(default_config, model_distribution_config)),
+                         LazyWeightsTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LazyWeightsDynamic,
+                         LazyWeightsTest,
+                         ::testing::Combine(::testing::Values(ov::PartialShape{-1, 96}),
+                                            ::testing::Values(std::vector<ov::Shape>{{5, 96}, {1, 96}, {5, 96}}),
+                                            ::testing::Values(default_config, model_distribution_config)),
+                         LazyWeightsTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -9,6 +9,7 @@
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/transpose.hpp"
@@ -283,6 +284,101 @@ protected:
     static constexpr size_t num_channels = 64ul;
 };
 
+// The A, alpha and B states hold pools of adapters stacked along axis 0, the adapter of each batch row is selected
+// by the adapter_ids input, so one batch mixes rows which use different adapters
+class LoraPatternAdapterPoolCPUTest : public LoraPatternBaseCPUTest {
+protected:
+    void init_function() override {
+        ov::PartialShape shape_x = {-1, -1, K};
+        ov::PartialShape shape_w = {N, K};
+
+        auto param_y = std::make_shared<ov::op::v0::Parameter>(netType, shape_x);
+        auto param_w = std::make_shared<ov::op::v0::Parameter>(netType, shape_w);
+        auto param_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_y, param_w, false, true);
+
+        auto pools = create_states({{-1, N, -1}, {-1, 1, -1}, {-1, -1, K}}, {t4_name, t5_name, t6_name});
+        ov::OutputVector states;
+        for (const auto& pool : pools.first) {
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            states.push_back(std::make_shared<ov::op::v8::Gather>(pool, param_ids, axis));
+        }
+
+        auto t5810 = std::make_shared<ov::op::v0::MatMul>(param_y, states[2], false, true);
+        auto t5811 = std::make_shared<ov::op::v1::Multiply>(t5810, states[1]);
+        auto t5812 = std::make_shared<ov::op::v0::MatMul>(t5811, states[0], false, true);
+
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, t5812);
+
+        auto result_x = std::make_shared<ov::op::v0::Result>(tx);
+        auto result_z = std::make_shared<ov::op::v0::Result>(tz);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector({result_x, result_z}),
+                                               pools.second,
+                                               ov::ParameterVector({param_y, param_w, param_ids}));
+    }
+
+    void run_adapter_pool_test() {
+        compile_model();
+        inferRequest = compiledModel.create_infer_request();
+        ASSERT_TRUE(inferRequest);
+        auto compiledReferenceModel = core->compile_model(function, ov::test::utils::DEVICE_TEMPLATE);
+        auto inferRequestRef = compiledReferenceModel.create_infer_request();
+        ASSERT_TRUE(inferRequestRef);
+
+        using ov::test::utils::InputGenerateData;
+        const auto& params = function->get_parameters();
+        auto x = ov::test::utils::create_and_fill_tensor(netType, {batch, 20, K}, InputGenerateData{-1, 2, 100, 1});
+        auto w = ov::test::utils::create_and_fill_tensor(netType, {N, K}, InputGenerateData{-1, 2, 100, 2});
+        for (auto* request : {&inferRequest, &inferRequestRef}) {
+            request->set_tensor(params[0], x);
+            request->set_tensor(params[1], w);
+        }
+
+        // register the adapters once, they are selected by the indices afterwards
+        const std::unordered_map<std::string, ov::Shape> pool_shapes = {{t4_name, {adapters, N, lora_order}},
+                                                                         {t5_name, {adapters, 1, lora_order}},
+                                                                         {t6_name, {adapters, lora_order, K}}};
+        int seed = 3;
+        for (auto&& state : inferRequest.query_state()) {
+            auto tensor = ov::test::utils::create_and_fill_tensor(states_precision,
+                                                                  pool_shapes.at(state.get_name()),
+                                                                  InputGenerateData{-1, 2, 100, seed++});
+            state.set_state(tensor);
+            for (auto&& ref_state : inferRequestRef.query_state()) {
+                if (ref_state.get_name() == state.get_name()) {
+                    ref_state.set_state(tensor);
+                }
+            }
+        }
+
+        const std::vector<std::vector<int32_t>> adapter_ids = {{0, 1, 2}, {2, 2, 0}, {1, 0, 1}, {2, 1, 0}};
+        for (const auto& ids : adapter_ids) {
+            ov::Tensor ids_tensor(ov::element::i32, {batch});
+            std::copy(ids.begin(), ids.end(), ids_tensor.data<int32_t>());
+            inferRequest.set_tensor(params[2], ids_tensor);
+            inferRequestRef.set_tensor(params[2], ids_tensor);
+
+            inferRequest.infer();
+            inferRequestRef.infer();
+
+            for (const auto& output : function->outputs()) {
+                ov::test::utils::compare(inferRequestRef.get_tensor(output),
+                                         inferRequest.get_tensor(output),
+                                         1e-4,
+                                         1e-4);
+            }
+        }
+    }
+
+    static constexpr size_t K = 96ul;
+    static constexpr size_t N = 160ul;
+    static constexpr size_t batch = 3ul;
+    static constexpr size_t adapters = 3ul;
+    static constexpr size_t lora_order = 16ul;
+};
+
 TEST_P(LoraPatternMatmulCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED();
     targetStaticShapes = {{{{1, 20, K}}, {{N, K}}}};
@@ -299,6 +395,13 @@ TEST_P(LoraPatternConvolutionCPUTest, CompareWithRefs) {
     CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 0);
 }
 
+TEST_P(LoraPatternAdapterPoolCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run_adapter_pool_test();
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CPUTestUtils::CheckNumberOfNodesWithType(compiledModel, "MatMul", 1);
+}
+
 const ov::element::TypeVector states_precisions {ov::element::f32, ov::element::f16};
 const std::vector<StatesPolicy> states_policies {StatesPolicy::EMPTY_TENSORS, StatesPolicy::RANDOM_TENSORS};
 
@@ -308,6 +411,12 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_MatMul, LoraPatternMatmulCPUTes
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_AdapterPool, LoraPatternAdapterPoolCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(states_precisions),
+                                 ::testing::Values(StatesPolicy::RANDOM_TENSORS)),
+                         LoraPatternBaseCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPUTest,
                          ::testing::Combine(
                                  ::testing::ValuesIn(states_precisions),
@@ -1,6 +1,8 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
+
 #include "openvino/opsets/opset13_decl.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/op_conversions/scaled_dot_product_attention_decomposition.hpp"
@@ -19,7 +21,9 @@ namespace ov {
 namespace test {
 
 using SDPAGroupBeamSearchTestParams = std::tuple<ElementType,
-                                       std::vector<InputShape>
+                                       std::vector<InputShape>,
+                                       std::vector<std::vector<int32_t>>,  // beam_idx of each step, rotation if empty
+                                       bool                                // force kvcache u8
                                        >;
 // Subgraph:
 /*                            Parameter
@@ -44,7 +48,7 @@ class SDPAGroupBeamSearchTest : public testing::WithParamInterface<SDPAGroupBeam
                                 public CPUTestsBase {
 public:
     static std::string getTestCaseName(const testing::TestParamInfo<SDPAGroupBeamSearchTestParams>& obj) {
-        const auto& [inType, inputShapes] = obj.param;
+        const auto& [inType, inputShapes, beamIdx, forceKVU8] = obj.param;
         std::ostringstream result;
         result << "IS=";
         for (const auto& shape : inputShapes) {
@@ -60,18 +64,30 @@ public:
             }
             result << ")_";
         }
-        result << "Prc=" << inType;
+        result << "Prc=" << inType << "_";
+        if (!beamIdx.empty()) {
+            result << "BeamIdx=";
+            for (const auto& idx : beamIdx) {
+                result << ov::test::utils::vec2str(idx);
+            }
+            result << "_";
+        }
+        result << "ForceKVU8=" << forceKVU8;
         return result.str();
     }
 
     void SetUp() override {
-        const auto& [inType, inputShapes] = this->GetParam();
+        const auto& [inType, inputShapes, beamIdx, forceKVU8] = this->GetParam();
+        m_beamIdx = beamIdx;
         targetDevice = ov::test::utils::DEVICE_CPU;
         rel_threshold = 1e-2f;
         if (inType == ElementType::bf16) {
             configuration.insert({"ENFORCE_BF16", "YES"});
             rel_threshold = 0.01f;
         }
+        if (forceKVU8) {
+            configuration["KV_CACHE_PRECISION"] = "u8";
+        }
         init_input_shapes(inputShapes);
         ov::ParameterVector inputParams;
         // q,k,v
@@ -143,7 +159,7 @@ public:
                 auto* p = static_cast<int*>(t.data());
                 auto start = static_cast<int>(val);
                 for (size_t i = 0; i < size; i++) {
-                    p[i] = (start + i) % beam_num;
+                    p[i] = m_beamIdx.empty() ? (start + i) % beam_num : m_beamIdx[start][i];
                 }
                 inputs.insert({param, t});
             } else if (param->get_element_type() == element::f32) {
@@ -190,10 +206,24 @@ public:
             outputTensor.copy_to(copy);
             outputs.push_back(copy);
         }
+        // the states are read through the beam table, they hold the reordered and shared rows of each beam
+        for (std::string name : {"pastk", "pastv"}) {
+            auto states = inferRequest.query_state();
+            auto itr = std::find_if(states.begin(), states.end(), [&](const ov::VariableState& state) {
+                return name == state.get_name();
+            });
+            OPENVINO_ASSERT(itr != states.end(), "Failed to find ", name, " state");
+            auto state_tensor = itr->get_state();
+            ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+            state_tensor.copy_to(copy);
+            outputs.push_back(copy);
+        }
         reset();
 
         return outputs;
     }
+
+    std::vector<std::vector<int32_t>> m_beamIdx;
 };
 
 TEST_P(SDPAGroupBeamSearchTest, CompareWithRefs) {
@@ -223,7 +253,39 @@ const std::vector<std::vector<InputShape>> inputShapes = {
 INSTANTIATE_TEST_SUITE_P(smoke_SDPAGroupBeamSearchTest,
                          SDPAGroupBeamSearchTest,
                          ::testing::Combine(::testing::Values(ElementType::f32),
-                                            ::testing::ValuesIn(inputShapes)),
+                                            ::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(std::vector<std::vector<int32_t>>{}),
+                                            ::testing::Values(false)),
+                         SDPAGroupBeamSearchTest::getTestCaseName);
+
+// The prompt is expanded to 4 beams which share its rows in the cache, then the beams are pruned and duplicated,
+// the 20 tokens step grows the cache, the last steps shrink the batch to 2 beams sharing their rows.
+const std::vector<std::vector<InputShape>> sharedPrefixShapes = {
+    {
+        // B, H, L1, S
+        {{-1, 8, -1, 64},
+         {{1, 8, 10, 64}, {4, 8, 1, 64}, {4, 8, 1, 64}, {4, 8, 1, 64}, {4, 8, 20, 64}, {2, 8, 1, 64}, {2, 8, 1, 64}}},
+        // B, H, L0, S
+        {{-1, 8, -1, 64},
+         {{1, 8, 0, 64},
+          {4, 8, 10, 64},
+          {4, 8, 11, 64},
+          {4, 8, 12, 64},
+          {4, 8, 13, 64},
+          {2, 8, 33, 64},
+          {2, 8, 34, 64}}},
+    },
+};
+
+const std::vector<std::vector<int32_t>> sharedPrefixBeamIdx =
+    {{0}, {0, 0, 0, 0}, {1, 1, 0, 2}, {3, 0, 0, 1}, {2, 3, 3, 2}, {1, 3}, {0, 0}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SDPAGroupBeamSearchTest_SharedPrefix,
+                         SDPAGroupBeamSearchTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(sharedPrefixShapes),
+                                            ::testing::Values(sharedPrefixBeamIdx),
+                                            ::testing::Values(true, false)),
                          SDPAGroupBeamSearchTest::getTestCaseName);
 
 }  // namespace
@@ -4,6 +4,8 @@
 
 #include "custom/subgraph_tests/src/classes/matmul_weights_decompression.hpp"
 
+#include <limits>
+
 #include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
 
 using namespace CPUTestUtils;
@@ -298,6 +300,8 @@ std::vector<ov::AnyMap> filter_additional_config_dyn_quant() {
         {{ov::hint::dynamic_quantization_group_size(0)}},  // dynamic quantization is disabled
         {{ov::hint::dynamic_quantization_group_size(16)}},
         {{ov::hint::dynamic_quantization_group_size(128)}},
+        // per-token, refined to the group size of the grouped weights
+        {{ov::hint::dynamic_quantization_group_size(std::numeric_limits<uint64_t>::max())}},
     };
     return additional_config;
 }
@@ -407,7 +411,8 @@ std::vector<ov::AnyMap> filter_additional_config_non_multiples_groups() {
 }
 
 // Dynamic quantization requires weights compression group size to be divisible on dq group size
-// The test is intended to chech such case is correctly handled via non dq path
+// The test is intended to check such case is correctly handled either via the dq path with the group size refined to
+// a common divisor (96 and 64 -> 32) or via non dq path
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_non_multiples_groups,
                          MatmulWeightsDecompression,
                          ::testing::Combine(::testing::ValuesIn(input_shapes_non_multiples_groups),
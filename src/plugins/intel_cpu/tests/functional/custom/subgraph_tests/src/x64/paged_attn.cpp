@@ -270,9 +270,9 @@ public:
         size_t scale_idx = 4;
 
         std::shared_ptr<ov::op::v13::ScaledDotProductAttention> sdp;
-        // For sliding window case, set causal=false because we provide explicit mask with sliding window logic
+        // For sliding window and block-sparse cases, set causal=false because we provide explicit mask
         // For normal case, set causal=true to let SDPA apply causal mask internally
-        bool use_causal = (this->sliding_window == 0);
+        bool use_causal = (this->sliding_window == 0 && this->sparse_local_blocks == 0);
 
         if (use_sink_input) {
             // 7-parameter SDPA constructor with sink support
@@ -344,6 +344,13 @@ public:
         ov::ParameterVector inputParams;
 
         this->sliding_window = slidingWindow;
+        auto get_sparse_param = [&](const std::string& name) -> size_t {
+            auto it = additional_config.find(name);
+            return it == additional_config.end() ? 0 : static_cast<size_t>(it->second.as<int32_t>());
+        };
+        sparse_local_blocks = get_sparse_param(ov::intel_cpu::sparse_attn_local_blocks.name());
+        sparse_sink_tokens = get_sparse_param(ov::intel_cpu::sparse_attn_sink_tokens.name());
+        sparse_global_stride = get_sparse_param(ov::intel_cpu::sparse_attn_global_stride.name());
         function = get_model(inType, enableXattn, 64, 8, sinkInput, slidingWindow);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
@@ -492,8 +499,8 @@ public:
             const size_t q_len = targetInputStaticShapes[0][0];
             const size_t total_kv_len = static_cast<size_t>(past_len_count) + q_len;
 
-            if (sliding_window > 0) {
-                // Sliding window: rectangular mask with sliding window logic
+            if (sliding_window > 0 || sparse_local_blocks > 0) {
+                // Sliding window or block-sparse pattern: rectangular mask with the same logic as the kernels
                 ov::Tensor mask_tensor(ov::element::f32, {1, head_num, q_len, total_kv_len});
                 auto* mask_data = mask_tensor.data<float>();
                 const float neg_inf = -std::numeric_limits<float>::infinity();
@@ -502,11 +509,16 @@ public:
                 for (size_t h = 0; h < head_num; ++h) {
                     for (size_t q_pos = 0; q_pos < q_len; ++q_pos) {
                         const int32_t global_q_idx = past_len_count + static_cast<int32_t>(q_pos);
+                        // a query block uses the pattern of its first query
+                        const size_t pattern_q_idx = past_len_count + q_pos / kv_block_size * kv_block_size;
                         for (size_t kv_idx = 0; kv_idx < total_kv_len; ++kv_idx) {
                             const int32_t global_k_idx = static_cast<int32_t>(kv_idx);
-                            const bool within_window = global_k_idx > global_q_idx + offset;
+                            const bool within_window =
+                                sliding_window == 0 || global_k_idx > global_q_idx + offset;
                             const bool causal = global_k_idx <= global_q_idx;
-                            const bool allow = within_window && causal;
+                            const bool attended =
+                                sparse_local_blocks == 0 || is_kv_block_attended(kv_idx / kv_block_size, pattern_q_idx);
+                            const bool allow = within_window && causal && attended;
                             const size_t linear_idx = (h * q_len + q_pos) * total_kv_len + kv_idx;
                             mask_data[linear_idx] = allow ? 0.f : neg_inf;
                         }
@@ -541,6 +553,12 @@ public:
                          idx + 0.0f);  // beam_idx
         }
     }
+    // Mirrors the static block-sparse pattern of the PagedAttention executor
+    bool is_kv_block_attended(size_t k_blk, size_t q_pos) const {
+        const auto q_pos_blk = q_pos / kv_block_size;
+        return k_blk * kv_block_size < sparse_sink_tokens || k_blk + sparse_local_blocks > q_pos_blk ||
+               (sparse_global_stride != 0 && k_blk % sparse_global_stride == 0);
+    }
     void prepare() {
         compile_model();
         inferRequest = compiledModel.create_infer_request();
@@ -559,6 +577,10 @@ public:
     ov::Tensor value_cache;
     int32_t past_len_count = 0;
     int32_t sliding_window = 0;
+    size_t sparse_local_blocks = 0;
+    size_t sparse_sink_tokens = 0;
+    size_t sparse_global_stride = 0;
+    static constexpr size_t kv_block_size = 32;
 };
 
 class PagedAttnVSSDPATest : public PagedAttnTestBase {
@@ -683,6 +705,69 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_WithSlidingWindowAndSinks,
                                             ::testing::Values(ov::AnyMap{
                                                 {ov::intel_cpu::enable_sage_attn.name(), false}})),
                          PagedAttnTestBase::getTestCaseName);
+
+// the local blocks of the block-sparse pattern cover the whole context, so the result must match the dense SDPA
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_BlockSparsePattern,
+                         PagedAttnVSSDPATest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),  // extendBlockIndices
+                                            ::testing::Values(false),  // enableXattn
+                                            ::testing::Values(false),  // sinkInput
+                                            ::testing::Values(0),      // sliding_window
+                                            ::testing::Values(ov::AnyMap{
+                                                {ov::intel_cpu::enable_sage_attn.name(), false},
+                                                {ov::intel_cpu::sparse_attn_local_blocks.name(), 16},
+                                                {ov::intel_cpu::sparse_attn_sink_tokens.name(), 4},
+                                                {ov::intel_cpu::sparse_attn_global_stride.name(), 4}})),
+                         PagedAttnTestBase::getTestCaseName);
+
+// prefill of 256 and 200 tokens followed by two decode steps, so the last blocks are partially filled
+const std::vector<InputShapes> blockSparseShapes = {
+    {
+        {{-1, 1, 8, 64}, {{256, 1, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}}},
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {256, 1, 8, 64}, {257, 1, 8, 64}}},
+    },
+    {
+        {{-1, 1, 8, 64}, {{200, 1, 8, 64}, {1, 1, 8, 64}, {1, 1, 8, 64}}},
+        {{-1, 1, 8, 64}, {{0, 1, 8, 64}, {200, 1, 8, 64}, {201, 1, 8, 64}}},
+    }};
+
+// The patterns skip KV blocks for both prefill and decode, the reference SDPA applies the same block mask.
+// A single thread executes decode with exec_kernel_one_bh, several threads with exec_loop_bhl.
+const std::vector<ov::AnyMap> blockSparseConfigs = [] {
+    // {local blocks, sink tokens, global stride}
+    const std::vector<std::vector<int32_t>> patterns = {
+        {2, 32, 3},  // sink block 0, local and dilated global blocks
+        {1, 0, 0},   // the query block only, block 0 is skipped
+        {2, 4, 0},   // sink tokens are rounded up to the whole block 0
+    };
+    std::vector<ov::AnyMap> configs;
+    for (const auto& pattern : patterns) {
+        for (int32_t threads : {1, 0}) {
+            ov::AnyMap config{{ov::intel_cpu::enable_sage_attn.name(), false},
+                              {ov::intel_cpu::sparse_attn_local_blocks.name(), pattern[0]},
+                              {ov::intel_cpu::sparse_attn_sink_tokens.name(), pattern[1]},
+                              {ov::intel_cpu::sparse_attn_global_stride.name(), pattern[2]}};
+            if (threads != 0) {
+                config[ov::inference_num_threads.name()] = threads;
+            }
+            configs.push_back(config);
+        }
+    }
+    return configs;
+}();
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnVSSDPATest_BlockSparseMasked,
+                         PagedAttnVSSDPATest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(blockSparseShapes),
+                                            ::testing::Values(false),  // extendBlockIndices
+                                            ::testing::Values(false),  // enableXattn
+                                            ::testing::Values(false),  // sinkInput
+                                            ::testing::Values(0),      // sliding_window
+                                            ::testing::ValuesIn(blockSparseConfigs)),
+                         PagedAttnTestBase::getTestCaseName);
 }  // namespace
 
 class PagedAttnVSMatmulTest : public PagedAttnTestBase {
@@ -11,6 +11,8 @@
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "ov_ops/rotary_positional_embeddings.hpp"
 
 namespace ov {
 namespace test {
@@ -136,6 +138,137 @@ INSTANTIATE_TEST_SUITE_P(smoke_QKVProjFusion,
                          ::testing::ValuesIn(qkv_params),
                          QKVProjFusionTest::getTestCaseName);
 
+}  // namespace
+
+using QKVProjRoPEFusionParams = std::tuple<size_t,    // head size
+                                           int32_t>;  // inference threads
+
+/* Q and K projections followed by Reshape and rotate-half RoPE are folded into one QKVProjection node computed in
+ * bf16. The reference is the same model executed by the CPU plugin in f32, where MatMul and RoPE are not fused.
+ */
+class QKVProjRoPEFusionTest : public testing::WithParamInterface<QKVProjRoPEFusionParams>,
+                              public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QKVProjRoPEFusionParams>& obj) {
+        const auto& [head_size, threads] = obj.param;
+        std::ostringstream result;
+        result << "head_size=" << head_size << "_";
+        result << "threads=" << threads;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t hidden = 2048;
+    static constexpr size_t q_heads = 16;
+    static constexpr size_t kv_heads = 4;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const size_t head_size = std::get<0>(this->GetParam());
+        const int32_t threads = std::get<1>(this->GetParam());
+
+        configuration[ov::hint::inference_precision.name()] = ov::element::bf16;
+        configuration[ov::inference_num_threads.name()] = threads;
+        abs_threshold = 0.1;
+        rel_threshold = 0.02;
+
+        const auto S = static_cast<int64_t>(head_size);
+        init_input_shapes({{{-1, -1, static_cast<int64_t>(hidden)}, {{1, 8, hidden}, {2, 5, hidden}}},
+                           {{-1, 1, -1, S}, {{1, 1, 8, head_size}, {1, 1, 5, head_size}}},
+                           {{-1, 1, -1, S}, {{1, 1, 8, head_size}, {1, 1, 5, head_size}}}});
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto cos = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+        auto sin = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[2]);
+
+        auto proj = [&](size_t heads) {
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = -0.5;
+            in_data.range = 1;
+            in_data.resolution = 128;
+            const ov::Shape weight_shape{heads * head_size, hidden};
+            auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, weight_shape, in_data);
+            auto weight = std::make_shared<ov::op::v0::Constant>(tensor);
+            return std::make_shared<ov::op::v0::MatMul>(src, weight, false, true);
+        };
+        auto rope = [&](const ov::Output<ov::Node>& input, size_t heads) {
+            const std::vector<int64_t> target{0, 0, static_cast<int64_t>(heads), S};
+            auto target_shape = ov::op::v0::Constant::create(ov::element::i64, {4}, target);
+            auto reshape = std::make_shared<ov::op::v1::Reshape>(input, target_shape, true);
+            ov::op::internal::RoPE::Config config;
+            config.input_trans0213 = true;
+            config.rotary_ndims = head_size;
+            config.cos_sin_ndims = head_size;
+            config.head_cnt = heads;
+            config.head_size = head_size;
+            return std::make_shared<ov::op::internal::RoPE>(ov::OutputVector{reshape, cos, sin}, config);
+        };
+
+        auto q = rope(proj(q_heads), q_heads);
+        auto k = rope(proj(kv_heads), kv_heads);
+        auto v = proj(kv_heads);
+        function = std::make_shared<ov::Model>(ov::OutputVector{q, k, v}, ov::ParameterVector{src, cos, sin});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& params = function->get_parameters();
+        for (size_t i = 0; i < params.size(); i++) {
+            ov::test::utils::InputGenerateData in_data;
+            in_data.start_from = -1;
+            in_data.range = 2;
+            in_data.resolution = 256;
+            const auto& shape = targetInputStaticShapes[i];
+            inputs.insert({params[i], ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, in_data)});
+        }
+    }
+
+    std::vector<ov::Tensor> calculate_refs() override {
+        update_ref_model();
+        auto ref_config = configuration;
+        ref_config[ov::hint::inference_precision.name()] = ov::element::f32;
+        auto ref_request = core->compile_model(functionRefs, targetDevice, ref_config).create_infer_request();
+        for (const auto& param : functionRefs->get_parameters()) {
+            ref_request.set_tensor(param->get_default_output(), inputs.at(matched_parameters[param]));
+        }
+        ref_request.infer();
+
+        std::vector<ov::Tensor> outputs;
+        for (const auto& output : functionRefs->outputs()) {
+            outputs.push_back(ref_request.get_tensor(output));
+        }
+        return outputs;
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+
+        int fused_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            ASSERT_NE(layer_type, "RoPE");
+            if (layer_type == "QKVProjection")
+                fused_node_found++;
+        }
+        ASSERT_EQ(fused_node_found, 1);
+    }
+};
+
+TEST_P(QKVProjRoPEFusionTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx512_core_amx_bf16())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
+namespace {
+
+// QKVProjection needs the number of threads to be close to a multiple of 3
+INSTANTIATE_TEST_SUITE_P(smoke_QKVProjRoPEFusion,
+                         QKVProjRoPEFusionTest,
+                         ::testing::Combine(::testing::Values(64, 128), ::testing::Values(3, 6, 12)),
+                         QKVProjRoPEFusionTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -4,12 +4,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <thread>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "common_test_utils/test_assertions.hpp"
+#include "openvino/runtime/system_conf.hpp"
 
 using namespace ov::intel_cpu;
 
@@ -102,3 +106,117 @@ TEST(StaticMemoryTest, UnsupportedDnnlPrecision) {
     ASSERT_THROW(dnnl_memory = testMemory->getPrimitive(), ov::Exception);
     ASSERT_FALSE(dnnl_memory);
 }
+
+TEST(MemoryTest, NumaPlacementFirstTouch) {
+    constexpr size_t size = 4 * 1024 * 1024;
+    MemoryBlockWithReuse block(NumaPlacement{NumaPlacement::Policy::FIRST_TOUCH, 0});
+    ASSERT_TRUE(block.resize(size));
+
+    const auto* data = static_cast<const uint8_t*>(block.getRawPtr());
+    ASSERT_NE(data, nullptr);
+    ASSERT_TRUE(std::all_of(data, data + size, [](uint8_t value) {
+        return value == 0;
+    }));
+
+#if defined(__linux__)
+    // all the pages have been touched, so all of them must be resident on some node
+    auto resident = numa_resident_bytes(data, size);
+    size_t total = 0;
+    for (auto&& item : resident) {
+        total += item.second;
+    }
+    ASSERT_GE(total, size);
+#endif
+}
+
+TEST(MemoryTest, NumaPlacementFirstTouchRegrow) {
+    constexpr size_t size = 4 * 1024 * 1024;
+    MemoryBlockWithReuse block(NumaPlacement{NumaPlacement::Policy::FIRST_TOUCH, 0});
+    ASSERT_TRUE(block.resize(size));
+    auto* data = static_cast<uint8_t*>(block.getRawPtr());
+    std::fill(data, data + size, uint8_t{1});
+
+    // a smaller request reuses the block as is
+    ASSERT_FALSE(block.resize(size / 2));
+    ASSERT_EQ(block.getRawPtr(), data);
+    ASSERT_TRUE(std::all_of(data, data + size, [](uint8_t value) {
+        return value == 1;
+    }));
+
+    // a bigger request allocates a new block, which is touched completely
+    ASSERT_TRUE(block.resize(2 * size));
+    const auto* newData = static_cast<const uint8_t*>(block.getRawPtr());
+    ASSERT_NE(newData, nullptr);
+#if defined(__linux__)
+    auto resident = numa_resident_bytes(newData, 2 * size);
+    size_t total = 0;
+    for (auto&& item : resident) {
+        total += item.second;
+    }
+    ASSERT_GE(total, 2 * size);
+#endif
+}
+
+TEST(MemoryTest, NumaPlacementFirstTouchKeepsMappedPages) {
+#if defined(__linux__)
+    const auto numa_nodes = ov::get_available_numa_nodes();
+    if (numa_nodes.size() < 2) {
+        GTEST_SKIP() << "The page placement can be checked only on a system with several NUMA nodes";
+    }
+    // the pages are mapped on the last node, while the first touch placement targets the first one
+    constexpr size_t size = 1024 * 1024 + 123;
+    MemoryBlockWithReuse block(NumaPlacement{NumaPlacement::Policy::BIND, numa_nodes.back()});
+    ASSERT_TRUE(block.resize(size));
+    auto* data = static_cast<uint8_t*>(block.getRawPtr());
+    std::fill(data, data + size, uint8_t{7});
+    const auto resident = numa_resident_bytes(data, size);
+    ASSERT_EQ(resident.size(), 1U);
+    ASSERT_EQ(resident.begin()->first, ov::get_org_numa_id(numa_nodes.back()));
+
+    ASSERT_TRUE(apply_numa_placement(data + 1, size - 1, {NumaPlacement::Policy::FIRST_TOUCH, numa_nodes.front()}));
+    ASSERT_TRUE(std::all_of(data, data + size, [](uint8_t value) {
+        return value == 7;
+    }));
+    // the mapped pages are neither moved nor remapped
+    ASSERT_EQ(numa_resident_bytes(data, size), resident);
+#else
+    GTEST_SKIP() << "The page placement can be checked only on Linux";
+#endif
+}
+
+TEST(MemoryTest, NumaPlacementInterleave) {
+    constexpr size_t size = 4 * 1024 * 1024;
+    MemoryBlockWithReuse block(NumaPlacement{NumaPlacement::Policy::INTERLEAVE, -1});
+    ASSERT_TRUE(block.resize(size));
+    auto* data = static_cast<uint8_t*>(block.getRawPtr());
+    ASSERT_NE(data, nullptr);
+    std::fill(data, data + size, uint8_t{1});
+
+#if defined(__linux__)
+    auto resident = numa_resident_bytes(data, size);
+    size_t total = 0;
+    for (auto&& item : resident) {
+        total += item.second;
+    }
+    ASSERT_GE(total, size);
+    // the pages are spread across the nodes only when the system has several of them
+    if (ov::get_available_numa_nodes().size() > 1) {
+        ASSERT_GT(resident.size(), 1);
+    }
+#endif
+}
+
+TEST(MemoryTest, HugePagesFallback) {
+    constexpr size_t size = 4 * 1024 * 1024;
+    for (auto mode : {ov::intel_cpu::HugePagesMode::TRANSPARENT, ov::intel_cpu::HugePagesMode::EXPLICIT}) {
+        // explicit huge pages are usually not reserved on CI machines, so the allocation must fall back silently
+        MemoryBlockWithReuse block(NumaPlacement{}, mode);
+        ASSERT_TRUE(block.resize(size));
+        auto* data = static_cast<uint8_t*>(block.getRawPtr());
+        ASSERT_NE(data, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % (2 * 1024 * 1024), 0);
+        std::fill(data, data + size, uint8_t{1});
+        ASSERT_LE(huge_page_resident_bytes(data, size), size);
+        block.free();
+    }
+}
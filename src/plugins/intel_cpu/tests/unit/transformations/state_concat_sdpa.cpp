@@ -237,3 +237,90 @@ TEST(TransformationTests, StateConcatSDPAWithExtraNode) {
         }
     }
 }
+
+// the 2nd SDPA attends over the present KV of the 1st layer (cross-layer KV sharing)
+static std::shared_ptr<ov::Model> makeCrossLayerSDPA(const ov::PartialShape& inputShape,
+                                                     bool isRef = false,
+                                                     bool readerDependsOnOwner = true) {
+    auto q = std::make_shared<ov::op::v0::Parameter>(element::f32, inputShape);
+    auto k = std::make_shared<ov::op::v0::Parameter>(element::f32, inputShape);
+    auto v = std::make_shared<ov::op::v0::Parameter>(element::f32, inputShape);
+    auto q_other = std::make_shared<ov::op::v0::Parameter>(element::f32, inputShape);
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(element::i32, ov::PartialShape{-1});
+    auto var_k = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{inputShape, element::f32, "pastk"});
+    std::shared_ptr<ov::Node> pastk = std::make_shared<ov::op::v6::ReadValue>(k, var_k);
+    auto var_v = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{inputShape, element::f32, "pastv"});
+    std::shared_ptr<ov::Node> pastv = std::make_shared<ov::op::v6::ReadValue>(v, var_v);
+    Output<ov::Node> concatK, concatV, sdp, sdp_reader;
+    auto make_q_reader = [&](const Output<ov::Node>& sdp) -> Output<ov::Node> {
+        if (!readerDependsOnOwner) {
+            return q_other;
+        }
+        return std::make_shared<op::v1::Add>(sdp, op::v0::Constant::create(element::f32, {1}, {1.0f}));
+    };
+    if (isRef) {
+        ov::intel_cpu::ScaledDotProductAttentionWithKVCache::Config config;
+        config.fuse_concat = true;
+        auto new_node = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(
+            OutputVector{q, k, v, beam_idx, pastk, pastv},
+            config);
+        sdp = new_node->output(0);
+        concatK = new_node->output(1);
+        concatV = new_node->output(2);
+        config.kv_cache_reader = true;
+        sdp_reader = std::make_shared<ov::intel_cpu::ScaledDotProductAttentionWithKVCache>(
+            OutputVector{make_q_reader(sdp), k, v, beam_idx, pastk, pastv},
+            config);
+    } else {
+        pastk = std::make_shared<ov::op::v8::Gather>(pastk, beam_idx, op::v0::Constant::create(element::i32, {1}, {0}));
+        pastv = std::make_shared<ov::op::v8::Gather>(pastv, beam_idx, op::v0::Constant::create(element::i32, {1}, {0}));
+        concatK = std::make_shared<ov::op::v0::Concat>(OutputVector{pastk, k}, 2);
+        concatV = std::make_shared<ov::op::v0::Concat>(OutputVector{pastv, v}, 2);
+        sdp = std::make_shared<ov::opset13::ScaledDotProductAttention>(q, concatK, concatV, false);
+        sdp_reader =
+            std::make_shared<ov::opset13::ScaledDotProductAttention>(make_q_reader(sdp), concatK, concatV, false);
+    }
+    auto pastk_assign = std::make_shared<op::v6::Assign>(concatK, var_k);
+    auto pastv_assign = std::make_shared<op::v6::Assign>(concatV, var_v);
+
+    ResultVector results{std::make_shared<ov::op::v0::Result>(sdp), std::make_shared<ov::op::v0::Result>(sdp_reader)};
+    SinkVector sinks{pastk_assign, pastv_assign};
+    return std::make_shared<Model>(results, sinks, ParameterVector{q, k, v, q_other, beam_idx}, "CrossLayerConcatSDP");
+}
+
+TEST(TransformationTests, StateConcatSDPACrossLayerKVSharing) {
+#if defined(OPENVINO_ARCH_X86_64) && (defined(__ANDROID__) || defined(ANDROID))
+    GTEST_SKIP() << "Skipping StateConcatSDPACrossLayerKVSharing test on Android X64";
+#endif
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    auto inputShape = ov::PartialShape{-1, 8, -1, 64};
+    {
+        f = makeCrossLayerSDPA(inputShape);
+        pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<StatefulSDPAFusion>();
+        m.run_passes(f);
+    }
+    f_ref = makeCrossLayerSDPA(inputShape, true);
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, StateConcatSDPACrossLayerKVSharingWithoutOrder) {
+#if defined(OPENVINO_ARCH_X86_64) && (defined(__ANDROID__) || defined(ANDROID))
+    GTEST_SKIP() << "Skipping StateConcatSDPACrossLayerKVSharingWithoutOrder test on Android X64";
+#endif
+    // the reader doesn't depend on the node updating the KV cache, so it may run first: no fusion
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    auto inputShape = ov::PartialShape{-1, 8, -1, 64};
+    f = makeCrossLayerSDPA(inputShape, false, false);
+    f_ref = makeCrossLayerSDPA(inputShape, false, false);
+    pass::Manager m;
+    m.register_pass<ov::pass::InitNodeInfo>();
+    m.register_pass<StatefulSDPAFusion>();
+    m.run_passes(f);
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include <transformations/cpu_opset/common/pass/swap_convert_transpose.hpp>
+#include <transformations/cpu_opset/common/pass/swap_scale_shift_transpose.hpp>
+#include "openvino/op/convert.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+
+using namespace testing;
+
+class SwapScaleShiftTransposeTest: public TransformationTestsF {};
+
+TEST_F(SwapScaleShiftTransposeTest, PreprocessingChain) {
+    const ov::Shape shape{1, 224, 224, 3};
+    const std::vector<int64_t> input_order = {0, 3, 1, 2};
+    const std::vector<float> mean = {123.675f, 116.28f, 103.53f};
+    const std::vector<float> scale = {0.0171f, 0.0175f, 0.0174f};
+
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, shape);
+        auto convert = std::make_shared<ov::op::v0::Convert>(input, ov::element::f32);
+        auto mean_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, mean);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, mean_const);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{3}, scale);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale_const);
+        auto transpose_const =
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{input_order.size()}, input_order);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(multiply, transpose_const);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::SwapScaleShiftTranspose>();
+        manager.register_pass<ov::intel_cpu::SwapConvertTranspose>();
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, shape);
+        auto transpose_const =
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{input_order.size()}, input_order);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(input, transpose_const);
+        auto convert = std::make_shared<ov::op::v0::Convert>(transpose, ov::element::f32);
+        auto mean_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 3, 1, 1}, mean);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, mean_const);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 3, 1, 1}, scale);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale_const);
+
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{multiply}, ov::ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(SwapScaleShiftTransposeTest, NotModelInput) {
+    const ov::Shape shape{1, 16, 16, 3};
+    const std::vector<int64_t> input_order = {0, 3, 1, 2};
+
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto to_f16 = std::make_shared<ov::op::v0::Convert>(input, ov::element::f16);
+        auto convert = std::make_shared<ov::op::v0::Convert>(to_f16, ov::element::f32);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(convert, scale_const);
+        auto transpose_const =
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{input_order.size()}, input_order);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(multiply, transpose_const);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::SwapScaleShiftTranspose>();
+    }
+}
+
+TEST_F(SwapScaleShiftTransposeTest, FloatInputWithoutConvert) {
+    const ov::Shape shape{1, 16, 16, 3};
+    const std::vector<int64_t> input_order = {0, 3, 1, 2};
+
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto mean_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f});
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(input, mean_const);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {4.f, 5.f, 6.f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale_const);
+        auto transpose_const =
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{input_order.size()}, input_order);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(multiply, transpose_const);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::SwapScaleShiftTranspose>();
+    }
+}
+
+TEST_F(SwapScaleShiftTransposeTest, FloatInputWithConvert) {
+    const ov::Shape shape{1, 16, 16, 3};
+    const std::vector<int64_t> input_order = {0, 3, 1, 2};
+
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f16, shape);
+        auto convert = std::make_shared<ov::op::v0::Convert>(input, ov::element::f32);
+        auto scale_const = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {1.f, 2.f, 3.f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(convert, scale_const);
+        auto transpose_const =
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{input_order.size()}, input_order);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(multiply, transpose_const);
+
+        model = std::make_shared<ov::Model>(ov::OutputVector{transpose}, ov::ParameterVector{input});
+        manager.register_pass<ov::intel_cpu::SwapScaleShiftTranspose>();
+    }
+}
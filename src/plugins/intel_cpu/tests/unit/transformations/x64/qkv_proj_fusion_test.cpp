@@ -17,7 +17,9 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/pass/visualize_tree.hpp"
+#include "ov_ops/rotary_positional_embeddings.hpp"
 
 using namespace testing;
 using namespace ov::pass;
@@ -83,4 +85,77 @@ TEST_F(TransformationTestsF, QKVProjFusion1Test) {
         auto v_proj = std::make_shared<v0::Result>(qkv_proj->output(2));
         model_ref = std::make_shared<ov::Model>(OutputVector{q_proj, k_proj, v_proj}, ParameterVector{input_param});
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TransformationTestsF, QKVProjRoPEFusionTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+
+    size_t hidden_size = 2048;
+    size_t head_size = 128;
+    size_t q_proj_size = 2048;
+    size_t k_proj_size = 256;
+    size_t v_proj_size = 256;
+    intel_cpu::QKVProjectionNode::Config config{false,
+                                                static_cast<int>(hidden_size),
+                                                static_cast<int>(q_proj_size),
+                                                static_cast<int>(k_proj_size),
+                                                static_cast<int>(v_proj_size),
+                                                false};
+    auto make_qkv_inputs = [&](ParameterVector& params) {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        auto cos = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+        auto sin = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+        params = {input_param, cos, sin};
+        return OutputVector{input_param,
+                            std::make_shared<v0::Constant>(element::f16, Shape{q_proj_size, hidden_size}),
+                            std::make_shared<v0::Constant>(element::f16, Shape{k_proj_size, hidden_size}),
+                            std::make_shared<v0::Constant>(element::f16, Shape{v_proj_size, hidden_size})};
+    };
+    {
+        ParameterVector params;
+        auto qkv_proj = std::make_shared<intel_cpu::QKVProjectionNode>(make_qkv_inputs(params), config);
+
+        auto rope = [&](const Output<Node>& proj, size_t proj_size) {
+            auto head_cnt = static_cast<int64_t>(proj_size / head_size);
+            const std::vector<int64_t> target{0, 0, head_cnt, static_cast<int64_t>(head_size)};
+            auto target_shape = v0::Constant::create(element::i64, Shape{4}, target);
+            auto reshape = std::make_shared<v1::Reshape>(proj, target_shape, true);
+            ov::op::internal::RoPE::Config rope_config;
+            rope_config.input_trans0213 = true;
+            rope_config.rotary_ndims = head_size;
+            rope_config.cos_sin_ndims = head_size;
+            rope_config.head_cnt = proj_size / head_size;
+            rope_config.head_size = head_size;
+            return std::make_shared<ov::op::internal::RoPE>(OutputVector{reshape, params[1], params[2]}, rope_config);
+        };
+
+        auto q = std::make_shared<v0::Result>(rope(qkv_proj->output(0), q_proj_size));
+        auto k = std::make_shared<v0::Result>(rope(qkv_proj->output(1), k_proj_size));
+        auto v = std::make_shared<v0::Result>(qkv_proj->output(2));
+        model = std::make_shared<ov::Model>(OutputVector{q, k, v}, params);
+        manager.register_pass<ov::intel_cpu::QKVProjFusion>();
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjRoPEFusion>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+    }
+    {
+        ParameterVector params;
+        auto args = make_qkv_inputs(params);
+        args.push_back(params[1]);
+        args.push_back(params[2]);
+
+        auto rope_config = config;
+        rope_config.rope_rotary_ndims = static_cast<int>(head_size);
+        rope_config.rope_head_size = static_cast<int>(head_size);
+        rope_config.rope_cos_sin_ndims = static_cast<int>(head_size);
+        auto qkv_proj = std::make_shared<intel_cpu::QKVProjectionNode>(args, rope_config);
+
+        auto q = std::make_shared<v0::Result>(qkv_proj->output(0));
+        auto k = std::make_shared<v0::Result>(qkv_proj->output(1));
+        auto v = std::make_shared<v0::Result>(qkv_proj->output(2));
+        model_ref = std::make_shared<ov::Model>(OutputVector{q, k, v}, params);
+    }
+}